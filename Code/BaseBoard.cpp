@@ -1,5 +1,5 @@
 /// \file BaseBoard.cpp
-/// \brief Code for the base chessboard CBaseBoard.
+/// \brief Code for the base chessboard CBaseBoardT.
 
 // MIT License
 //
@@ -33,28 +33,30 @@ extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves.
 
 /// Construct an empty board.
 
-CBaseBoard::CBaseBoard(){
+template<class T> CBaseBoardT<T>::CBaseBoardT(){
 } //constructor
 
 /// Construct a square undirected board.
 /// \param n Board width and height.
 
-CBaseBoard::CBaseBoard(UINT n): CBaseBoard(n, n){
+template<class T> CBaseBoardT<T>::CBaseBoardT(UINT n): CBaseBoardT(n, n){
 } //constructor
 
 /// Construct a rectangular undirected board.
 /// \param w Board width.
 /// \param h Board height.
 
-CBaseBoard::CBaseBoard(UINT w, UINT h):
-  m_nWidth(w), m_nHeight(h), m_nSize(w*h)
+template<class T> CBaseBoardT<T>::CBaseBoardT(UINT w, UINT h):
+  m_nWidth(w), m_nHeight(h), m_nSize((T)w*h), m_nTableSize((T)w*h)
 {
   if(!(m_nSize & 1)){ //size must be even
-    m_nMove = new int[m_nSize]; //create move table
+    m_nMove = new T[m_nSize]; //create move table
 
-    for(UINT i=0; i<m_nSize; i++) //initialize move table
+    for(T i=0; i<m_nSize; i++) //initialize move table
       m_nMove[i] = UNUSED;
   } //if
+
+  BuildMoveTable();
   
   ::srand(timeGetTime());
   m_cRandom.srand();
@@ -65,30 +67,106 @@ CBaseBoard::CBaseBoard(UINT w, UINT h):
 /// \param h Board height.
 /// \param move A \f$w \times h\f$ move table.
 
-CBaseBoard::CBaseBoard(int move[], UINT w, UINT h):
-  m_nWidth(w), m_nHeight(h), m_nSize(w*h)
+template<class T> CBaseBoardT<T>::CBaseBoardT(const int move[], UINT w, UINT h):
+  m_nWidth(w), m_nHeight(h), m_nSize((T)w*h), m_nTableSize((T)w*h)
 {
   if(!(m_nSize & 1)){ //size must be even
-    m_nMove = new int[m_nSize]; //create move table
+    m_nMove = new T[m_nSize]; //create move table
 
-    for(UINT i=0; i<m_nSize; i++) //copy move table
+    for(T i=0; i<m_nSize; i++) //copy move table
       m_nMove[i] = move[i];
   } //if
+
+  BuildMoveTable();
 } //constructor
 
 /// Delete the move tables.
 
-CBaseBoard::~CBaseBoard(){
+template<class T> CBaseBoardT<T>::~CBaseBoardT(){
   delete [] m_nMove;
   delete [] m_nMove2;
+  delete [] m_nMoveMask;
+  delete [] m_nExitCount;
 } //destructor
 
-/// Make every entry in the primary move table UNUSED and delete 
-/// the secondary move table so that the cleared board is undirected.
+/// Build the tables that let us find knight's moves without dividing by the
+/// board width. The move offset table records for each move index the
+/// difference between the index of the destination cell and the index of the
+/// source cell. The move mask records for each cell a bit for each move
+/// index, which is set if and only if that move stays in the move table. The
+/// destination of move k from cell i is then i + m_nMoveOffset[k] provided
+/// bit k of m_nMoveMask[i] is set. On a padded board every move from a cell
+/// stays in the move table, and sentinels have no moves.
+
+template<class T> void CBaseBoardT<T>::BuildMoveTable(){
+  const int pad = m_bPadded? PADDING: 0; //width of sentinel border
+  const int w = m_nWidth + 2*pad; //width of move table
+  const int h = m_nHeight + 2*pad; //height of move table
+
+  for(int k=0; k<8; k++) //move offsets
+    m_nMoveOffset[k] = g_vecDeltas[k].second*w + g_vecDeltas[k].first;
+
+  delete [] m_nMoveMask;
+  m_nMoveMask = new BYTE[m_nTableSize]; //one bit per move for each cell
+
+  for(int y=0; y<h; y++)
+    for(int x=0; x<w; x++){
+      BYTE mask = 0; //moves from this cell that stay in the move table
+
+      if(InRangeX(x - pad) && InRangeY(y - pad)) //not a sentinel
+        for(int k=0; k<8; k++){
+          const int destx = x + g_vecDeltas[k].first; //destination column
+          const int desty = y + g_vecDeltas[k].second; //destination row
+
+          if(0 <= destx && destx < w && 0 <= desty && desty < h)
+            mask |= 1 << k;
+        } //for
+
+      m_nMoveMask[(T)y*w + x] = mask;
+    } //for
+} //BuildMoveTable
+
+/// Count the available moves from each cell of a padded board, that is, the
+/// knight's moves that go to an unused cell. Sentinels get a count of zero.
+
+template<class T> void CBaseBoardT<T>::BuildExitCounts(){
+  assert(m_bPadded); //safety
+
+  if(m_nExitCount == nullptr)
+    m_nExitCount = new BYTE[m_nTableSize];
 
-void CBaseBoard::Clear(){
-  for(UINT i=0; i<m_nSize; i++)
-    m_nMove[i] = UNUSED;
+  for(T i=0; i<m_nTableSize; i++){
+    BYTE count = 0; //number of available moves from cell i
+
+    if(m_nMoveMask[i] != 0) //not a sentinel
+      for(int k=0; k<8; k++)
+        count += m_nMove[i + m_nMoveOffset[k]] == UNUSED;
+
+    m_nExitCount[i] = count;
+  } //for
+} //BuildExitCounts
+
+/// Update the available move counts of the cells a knight's move away from
+/// a cell of a padded board that has just become used or unused. Since the
+/// knight's moves are symmetric, these are the cells that can move to it.
+/// \param index Cell index.
+/// \param delta -1 if the cell has become used, 1 if it has become unused.
+
+template<class T> void CBaseBoardT<T>::UpdateExitCounts(T index, int delta){
+  for(int k=0; k<8; k++)
+    m_nExitCount[index + m_nMoveOffset[k]] += delta;
+} //UpdateExitCounts
+
+/// Make every entry in the primary move table UNUSED (except for the
+/// sentinels on a padded board) and delete the secondary move table so
+/// that the cleared board is undirected.
+
+template<class T> void CBaseBoardT<T>::Clear(){
+  for(T i=0; i<m_nTableSize; i++) //sentinels have no moves
+    m_nMove[i] = (m_bPadded && m_nMoveMask[i] == 0)? BLOCKED: UNUSED;
+
+  if(m_bPadded)
+    BuildExitCounts();
 
   delete [] m_nMove2;
   m_nMove2 = nullptr;
@@ -99,15 +177,15 @@ void CBaseBoard::Clear(){
 /// \param index Cell index to test.
 /// \return true if cell index is actually on the board.
 
-bool CBaseBoard::CellIndexInRange(int index){
-  return 0 <= index && index < (int)m_nSize;
+template<class T> bool CBaseBoardT<T>::CellIndexInRange(T index) const{
+  return 0 <= index && index < m_nTableSize;
 } //CellIndexInRange
 
 /// Test whether a horizontal coordinate is on the board.
 /// \param x An x-coordinate.
 /// \return True if the x-coordinate is on the board.
 
-bool CBaseBoard::InRangeX(int x){
+template<class T> bool CBaseBoardT<T>::InRangeX(int x){
   return 0 <= x && x < (int)m_nWidth;
 } //InRangeX
 
@@ -115,7 +193,7 @@ bool CBaseBoard::InRangeX(int x){
 /// \param y A y-coordinate.
 /// \return True if the y-coordinate is on the board.
 
-bool CBaseBoard::InRangeY(int y){
+template<class T> bool CBaseBoardT<T>::InRangeY(int y){
   return 0 <= y && y < (int)m_nHeight;
 } //InRangeY
 
@@ -124,7 +202,7 @@ bool CBaseBoard::InRangeY(int y){
 /// \param j Board index.
 /// \return true if there is a move from cell i to cell j on the board.
 
-bool CBaseBoard::IsMove(int i, int j){
+template<class T> bool CBaseBoardT<T>::IsMove(T i, T j){
   return CellIndexInRange(i) && CellIndexInRange(j) &&
     (m_nMove[i] == j || m_nMove2[i] == j ||
      m_nMove[j] == i || m_nMove2[j] == i);
@@ -135,20 +213,8 @@ bool CBaseBoard::IsMove(int i, int j){
 /// \param j Board cell index.
 /// \return true if j is a knight's move from i (and vice-versa)
 
-bool CBaseBoard::IsKnightMove(int i, int j){
-  const int n = (int)m_nSize;
-
-  if(0 <= i && i < n && 0 <= j && j < n) //safety check 
-    for(MoveDelta delta: g_vecDeltas)
-      if(IsOnBoard(i, delta)){
-        const int x = i%m_nWidth + delta.first;
-        const int y = i/m_nWidth + delta.second;
-
-        if(j == y*m_nWidth + x)
-          return true;
-      } //if
-
-  return false;
+template<class T> bool CBaseBoardT<T>::IsKnightMove(T i, T j){
+  return CellIndexInRange(j) && GetMoveIndex(i, j) != UNUSED;
 } //IsKnightMove
 
 /// Test whether a cell is unused. Cells outside of the board 
@@ -158,7 +224,7 @@ bool CBaseBoard::IsKnightMove(int i, int j){
 /// \param index Cell index.
 /// \return true if the cell with that index is unused.
 
-bool CBaseBoard::IsUnused(int index){
+template<class T> bool CBaseBoardT<T>::IsUnused(T index){
   assert(IsDirected()); //safety
   return CellIndexInRange(index) && m_nMove[index] == UNUSED;
 } //IsUnused
@@ -168,56 +234,46 @@ bool CBaseBoard::IsUnused(int index){
 /// move takes us off the board, then the cell is reported as used.
 /// Assumes that the board is undirected.
 /// \param pos Board cell index.
-/// \param d Move deltas for a knight's move.
-/// \return true If the cell move d away from pos is unused.
+/// \param k Move index.
+/// \return true If the cell move k away from pos is unused.
 
-bool CBaseBoard::IsUnused(int pos, const MoveDelta& d){
+template<class T> bool CBaseBoardT<T>::IsUnused(T pos, int k){
   assert(IsUndirected()); //safety
-  if(!CellIndexInRange(pos))return false;
-  
-  const int x = pos%m_nWidth + d.first; //destination column
-  const int y = pos/m_nWidth + d.second; //destination row
-
-  return InRangeX(x) && InRangeY(y) && m_nMove[y*m_nWidth + x] == UNUSED;
+  return IsOnBoard(pos, k) && m_nMove[pos + m_nMoveOffset[k]] == UNUSED;
 } //IsUnused
 
 /// Test whether a move stays on the board.
-/// Assumes that the board is undirected.
 /// \param pos Cell index.
-/// \param d Move delta.
-/// \return true If the cell move d away from pos is on the board.
+/// \param k Move index.
+/// \return true If the cell move k away from pos is on the board.
 
-bool CBaseBoard::IsOnBoard(int pos, const MoveDelta& d){
-  if(!CellIndexInRange(pos))return false;
-  
-  const int x = pos%m_nWidth + d.first; //destination column
-  const int y = pos/m_nWidth + d.second; //destination row
-
-  return InRangeX(x) && InRangeY(y);
+template<class T> bool CBaseBoardT<T>::IsOnBoard(T pos, int k){
+  return CellIndexInRange(pos) && (m_nMoveMask[pos] >> k & 1);
 } //IsOnBoard
 
 /// Count the number of available moves from a given cell,
 /// that is, knight's moves that stay on the board and go
 /// to an unused cell. Assumes that the board is undirected.
+/// On a padded board the count is kept up to date as moves are
+/// inserted and deleted, so we just look it up.
 /// \param index Board cell index.
 /// \return Number of moves from that that end up in unoccupied cells.
 
-int CBaseBoard::GetAvailableMoveCount(int index){
+template<class T> int CBaseBoardT<T>::GetAvailableMoveCount(T index){
   assert(IsUndirected()); //safety
 
-  const int x0 = index%m_nWidth; //cell column
-  const int y0 = index/m_nWidth; //cell row
-
   int count = 0; //return value
 
-  for(MoveDelta delta: g_vecDeltas){
-    const int x = x0 + delta.first; //destination column of move delta
-    const int y = y0 + delta.second; //destination row of move delta
-    const int dest = y*m_nWidth + x; //destination index of move delta
+  if(m_bPadded) //look it up
+    count = m_nExitCount[index];
 
-    if(InRangeX(x) && InRangeY(y) && m_nMove[dest] == UNUSED)
-      count++;
-  } //for
+  else{ //check that moves stay on the board
+    const BYTE mask = m_nMoveMask[index]; //moves that stay on the board
+
+    for(int k=0; k<8; k++)
+      if((mask >> k & 1) && m_nMove[index + m_nMoveOffset[k]] == UNUSED)
+        count++;
+  } //else
 
   return count;
 } //GetAvailableMoveCount
@@ -229,7 +285,7 @@ int CBaseBoard::GetAvailableMoveCount(int index){
 /// \param index Cell index.
 /// \return Move from the cell with that index.
 
-int CBaseBoard::operator[](int index){
+template<class T> T CBaseBoardT<T>::operator[](T index) const{
   assert(IsUndirected()); //safety
   return CellIndexInRange(index)? m_nMove[index]: UNUSED;
 } //operator[]
@@ -237,16 +293,18 @@ int CBaseBoard::operator[](int index){
 /// Knight's tour test for both directed and undirected boards.
 /// \return true if this board contains a closed knight's tour.
 
-bool CBaseBoard::IsTour(){
-  int prev = 0;
-  int cur = m_nMove[0];
-  UINT count = 1;
+template<class T> bool CBaseBoardT<T>::IsTour(){
+  assert(!IsPadded()); //safety
+
+  T prev = 0;
+  T cur = m_nMove[0];
+  T count = 1;
 
   //now we can begin the tour
 
   while(count < m_nSize && CellIndexInRange(cur) && cur != 0){
-    const int dest0 = m_nMove[cur];
-    const int newprev = cur;
+    const T dest0 = m_nMove[cur];
+    const T newprev = cur;
 
     if(dest0 == prev){
       if(IsUndirected())return false; //this should never happen
@@ -265,10 +323,12 @@ bool CBaseBoard::IsTour(){
 /// Tourney test for both directed and undirected boards.
 /// \return true if this board contains a tourney.
 
-bool CBaseBoard::IsTourney(){
+template<class T> bool CBaseBoardT<T>::IsTourney(){
+  assert(!IsPadded()); //safety
+
   int *count = new int[m_nSize];
 
-  for(UINT i=0; i<m_nSize; i++)
+  for(T i=0; i<m_nSize; i++)
     count[i] = 0;
 
   //all cells must be used
@@ -276,7 +336,7 @@ bool CBaseBoard::IsTourney(){
   bool bAllCellsUsed = true;
 
   if(IsUndirected()){ //board is undirected
-    for(UINT i=0; i<m_nSize && bAllCellsUsed; i++){
+    for(T i=0; i<m_nSize && bAllCellsUsed; i++){
       if(CellIndexInRange(m_nMove[i])){
         ++count[i];
         ++count[m_nMove[i]];
@@ -286,7 +346,7 @@ bool CBaseBoard::IsTourney(){
   } //if
 
   else{ //board is directed
-    for(UINT i=0; i<m_nSize && bAllCellsUsed; i++){
+    for(T i=0; i<m_nSize && bAllCellsUsed; i++){
       if(CellIndexInRange(m_nMove[i]))
         ++count[m_nMove[i]];
       else bAllCellsUsed = false;
@@ -304,7 +364,7 @@ bool CBaseBoard::IsTourney(){
   bool bDegree2 = true;
 
   if(bAllCellsUsed)
-    for(UINT i=0; i<m_nSize; i++)
+    for(T i=0; i<m_nSize; i++)
       if(count[i] != 2)
         bDegree2 = false;
 
@@ -316,7 +376,7 @@ bool CBaseBoard::IsTourney(){
 /// Test whether the board is directed, that is, it is not undirected.
 /// \return true If the board is directed.
 
-bool CBaseBoard::IsDirected(){
+template<class T> bool CBaseBoardT<T>::IsDirected() const{
   return !IsUndirected();
 } //IsDirected
 
@@ -324,7 +384,7 @@ bool CBaseBoard::IsDirected(){
 /// then m_nMove2 will be NULL and vice-versa.
 /// \return true If the board is undirected.
 
-bool CBaseBoard::IsUndirected(){
+template<class T> bool CBaseBoardT<T>::IsUndirected() const{
   return m_nMove2 == nullptr;
 } //IsUndirected
 
@@ -332,13 +392,15 @@ bool CBaseBoard::IsUndirected(){
 /// move table and copying the edges in the first move table
 /// into back edges in the second one. 
 
-void CBaseBoard::MakeDirected(){
+template<class T> void CBaseBoardT<T>::MakeDirected(){
+  assert(!IsPadded()); //safety
+
   if(IsUndirected()){
-    m_nMove2 = new int[m_nSize];
-    for(UINT i=0; i<m_nSize; i++)
+    m_nMove2 = new T[m_nSize];
+    for(T i=0; i<m_nSize; i++)
       m_nMove2[i] = UNUSED;
 
-    for(UINT i=0; i<m_nSize; i++)
+    for(T i=0; i<m_nSize; i++)
       if(CellIndexInRange(m_nMove[i]))
        m_nMove2[m_nMove[i]] = i;
   } //if
@@ -348,23 +410,23 @@ void CBaseBoard::MakeDirected(){
 /// It is assumed that the directed board contains a tourney.
 /// If not, then this function does nothing.
 
-void CBaseBoard::MakeUndirected(){
+template<class T> void CBaseBoardT<T>::MakeUndirected(){
   if(IsDirected() && IsTourney()){   
-    int* temp = new int[m_nSize]; 
+    T* temp = new T[m_nSize]; 
   
-    for(UINT i=0; i<m_nSize; i++)
+    for(T i=0; i<m_nSize; i++)
       temp[i] = UNUSED;
 
-    for(UINT start=0; start<m_nSize; start++)
+    for(T start=0; start<m_nSize; start++)
       if(temp[start] == UNUSED){
 
-        int prev = start;
-        int cur = m_nMove[start];
+        T prev = start;
+        T cur = m_nMove[start];
 
         while(CellIndexInRange(cur) && cur != start){ 
           temp[prev] = cur;   
 
-          const int dest0 = (m_nMove[cur] == prev)? m_nMove2[cur]: m_nMove[cur];
+          const T dest0 = (m_nMove[cur] == prev)? m_nMove2[cur]: m_nMove[cur];
           prev = cur;
           cur = dest0;
         } //while
@@ -384,89 +446,192 @@ void CBaseBoard::MakeUndirected(){
   } //if
 } //MakeUndirected
 
+/// Add a sentinel border PADDING cells wide to the move table of an
+/// undirected board. The sentinels are BLOCKED, so they read as used cells.
+/// Cell indices, including those in the move table, become indices into the
+/// padded move table.
+
+template<class T> void CBaseBoardT<T>::MakePadded(){
+  assert(IsUndirected()); //safety
+
+  if(!m_bPadded){
+    const int w = m_nWidth + 2*PADDING; //width of padded move table
+    const int h = m_nHeight + 2*PADDING; //height of padded move table
+
+    int offset[8]; //move offsets in padded move table
+
+    for(int k=0; k<8; k++)
+      offset[k] = g_vecDeltas[k].second*w + g_vecDeltas[k].first;
+
+    const T n = (T)w*h; //size of padded move table
+    T* temp = new T[n]; //padded move table
+
+    for(T i=0; i<n; i++)
+      temp[i] = BLOCKED;
+
+    for(int y=0; y<(int)m_nHeight; y++)
+      for(int x=0; x<(int)m_nWidth; x++){
+        const T i = (T)y*m_nWidth + x; //cell index
+        const T j = (T)(y + PADDING)*w + x + PADDING; //padded cell index
+        const int k = GetMoveIndex(i, m_nMove[i]); //index of move from cell
+
+        temp[j] = (k == UNUSED)? UNUSED: j + offset[k];
+      } //for
+
+    delete [] m_nMove;
+    m_nMove = temp;
+
+    m_bPadded = true;
+    m_nTableSize = n;
+    BuildMoveTable(); 
+    BuildExitCounts();
+  } //if
+} //MakePadded
+
+/// Remove the sentinel border from the move table of a padded board.
+/// Cell indices, including those in the move table, go back to being
+/// indices into the unpadded move table.
+
+template<class T> void CBaseBoardT<T>::MakeUnpadded(){
+  if(m_bPadded){
+    const int w = m_nWidth + 2*PADDING; //width of padded move table
+
+    int offset[8]; //move offsets in unpadded move table
+
+    for(int k=0; k<8; k++)
+      offset[k] = g_vecDeltas[k].second*m_nWidth + g_vecDeltas[k].first;
+
+    T* temp = new T[m_nSize]; //unpadded move table
+
+    for(int y=0; y<(int)m_nHeight; y++)
+      for(int x=0; x<(int)m_nWidth; x++){
+        const T i = (T)y*m_nWidth + x; //cell index
+        const T j = (T)(y + PADDING)*w + x + PADDING; //padded cell index
+        const int k = GetMoveIndex(j, m_nMove[j]); //index of move from cell
+
+        temp[i] = (k == UNUSED)? UNUSED: i + offset[k];
+      } //for
+
+    delete [] m_nMove;
+    m_nMove = temp;
+
+    m_bPadded = false;
+    m_nTableSize = m_nSize;
+    BuildMoveTable(); 
+
+    delete [] m_nExitCount;
+    m_nExitCount = nullptr;
+  } //if
+} //MakeUnpadded
+
+/// Test whether the move table has a sentinel border.
+/// \return true If the board is padded.
+
+template<class T> bool CBaseBoardT<T>::IsPadded() const{
+  return m_bPadded;
+} //IsPadded
+
+/// Compute the index of a cell in the padded move table from its
+/// index in the unpadded one.
+/// \param index Cell index in the unpadded move table.
+/// \return Cell index in the padded move table.
+
+template<class T> T CBaseBoardT<T>::GetPaddedIndex(T index){
+  const T x = index%m_nWidth + PADDING; //padded column
+  const T y = index/m_nWidth + PADDING; //padded row
+
+  return y*(m_nWidth + 2*PADDING) + x;
+} //GetPaddedIndex
+
 /// Compute the destination of a move, given the cell index and the
-/// horizontal and vertical deltas of a move.
+/// move index.
 /// \param i Cell index.
-/// \param delta Move deltas.
-/// \return Destination of the move from cell i with move deltas delta.
-
-int CBaseBoard::GetDest(int i, const MoveDelta& delta){
-  int x = i%m_nWidth + delta.first;
-  int y = i/m_nWidth + delta.second;
+/// \param k Move index.
+/// \return Destination of move k from cell i, or UNUSED if it's off the board.
 
-  if(InRangeX(x) && InRangeY(y)) //move stays on board
-    return y*m_nWidth + x;
+template<class T> T CBaseBoardT<T>::GetDest(T i, int k){
+  if(IsOnBoard(i, k)) //move stays on board
+    return i + m_nMoveOffset[k];
   else return UNUSED; //fail
 } //GetDest
 
+/// Reader function for the difference between the index of the destination
+/// of a move and the index of its source. This is only guaranteed to give the
+/// destination of the move if it stays on the board, or the board is padded.
+/// \param k Move index.
+/// \return Cell index offset of move k.
+
+template<class T> int CBaseBoardT<T>::GetMoveOffset(int k){
+  return m_nMoveOffset[k];
+} //GetMoveOffset
+
 /// Compute the index of a knight's move given the indexes of the cells.
 /// Returns UNUSED if the move is not as knight's move.
 /// \param src Index of source cell.
 /// \param dest Index of destination cell.
 /// \return The move index of the knight's move from src to dest.
 
-int CBaseBoard::GetMoveIndex(int src, int dest){
-  const int dx = dest%m_nWidth - src%m_nWidth;
-  const int dy = dest/m_nWidth - src/m_nWidth;
-
-  switch(dx){
-    case -2: 
-      if(dy == -1)return 3;
-      else if(dy == 1)return 4;
-    break;
-
-    case -1: 
-      if(dy == -2)return 2;
-      else if(dy == 2)return 5;
-    break;
-
-    case 1: 
-      if(dy == -2)return 1;
-      else if(dy == 2)return 6;
-    break;
-    
-    case 2: 
-      if(dy == -1)return 0;
-      else if(dy == 1)return 7;
-    break;
-  } //switch
+template<class T> int CBaseBoardT<T>::GetMoveIndex(T src, T dest){
+  if(CellIndexInRange(src)){ //safety
+    const BYTE mask = m_nMoveMask[src]; //moves that stay on the board
+    const T delta = dest - src; //difference in cell indices
+
+    for(int k=0; k<8; k++)
+      if(m_nMoveOffset[k] == delta && (mask >> k & 1))
+        return k;
+  } //if
 
   return UNUSED; //bother, it's not a knight's move
 } //GetMoveIndex
 
 /// Copy a board into a sub-board of this board. 
-/// Assumes that the board to be copied in is undirected.
+/// Assumes that the board to be copied in is undirected and that the cells
+/// that it covers are unused. The copy is done a row at a time. A move in b
+/// from a cell to its destination is translated into this board by adding
+/// a constant offset to the source and by replacing the difference between
+/// source and destination, which depends on the width of b, by the one for
+/// the same knight's move on this board. The move tables are written
+/// directly, in the same order that inserting the moves one at a time would.
 /// \param b Undirected board to copy in.
 /// \param x0 Column of first cell in which to copy b.
 /// \param y0 Row of first cell in which to copy b.
 
-void CBaseBoard::CopyToSubBoard(CBaseBoard& b, int x0, int y0){
-  assert(b.IsUndirected()); //safety
+template<class T> void CBaseBoardT<T>::CopyToSubBoard(const CBaseBoardT<int>& b, int x0, int y0){
+  assert(b.IsUndirected() && !IsPadded()); //safety
 
-  const int w = b.m_nWidth;
-  const int h = b.m_nHeight;
-  
-  for(int bsrcy=0; bsrcy<h; bsrcy++)
-    for(int bsrcx=0; bsrcx<w; bsrcx++){
-      const int bsrc = bsrcy*w + bsrcx;
-      const int bdest = b[bsrc];
+  const int w = b.GetWidth();
+  const int h = b.GetHeight();
+
+  //translate the difference between cell indices for each knight's move in
+  //b into the difference for this board, indexed by the difference in b
+  //plus the largest possible backwards difference
 
-      const int bdestx = bdest%w;
-      const int bdesty = bdest/w;
+  const int bias = 2*w + 2; //largest backwards difference in b
+  std::vector<int> delta(2*bias + 1, 0); //difference in this board
 
-      const int srcx = bsrcx + x0;
-      const int srcy = bsrcy + y0;
-      
-      const int destx = bdestx + x0;
-      const int desty = bdesty + y0;
+  for(int k=0; k<8; k++)
+    delta[b.m_nMoveOffset[k] + bias] = m_nMoveOffset[k];
 
-      const int src = srcy*m_nWidth + srcx;
-      const int dest = desty*m_nWidth + destx;
+  const int* bmove = b.m_nMove; //move table of b
+  const bool bDirected = IsDirected();
+
+  for(int bsrcy=0; bsrcy<h; bsrcy++){
+    const int bsrc0 = bsrcy*w; //first cell of row in b
+    const T src0 = (T)(y0 + bsrcy)*m_nWidth + x0; //first cell of row here
+
+    for(int bsrcx=0; bsrcx<w; bsrcx++){
+      const int bsrc = bsrc0 + bsrcx;
+      const T src = src0 + bsrcx;
+      const T dest = src + delta[bmove[bsrc] - bsrc + bias];
 
-      if(IsDirected())
-        InsertDirectedMove(src, dest);
-      else InsertUndirectedMove(src, dest);
+      if(bDirected){
+        (m_nMove[src] < 0? m_nMove: m_nMove2)[src] = dest;
+        (m_nMove[dest] < 0? m_nMove: m_nMove2)[dest] = src;
+      } //if
+
+      else m_nMove[src] = dest;
     } //for
+  } //for
 } //CopyToSubBoard
 
 ////////////////////////////////////////////////////////////////////////
@@ -479,17 +644,26 @@ void CBaseBoard::CopyToSubBoard(CBaseBoard& b, int x0, int y0){
 /// \param dest The other end of move to insert.
 /// \return true if the insert was successful (the cells were unused).
 
-bool CBaseBoard::InsertUndirectedMove(int src, int dest){
+template<class T> bool CBaseBoardT<T>::InsertUndirectedMove(T src, T dest){
   assert(IsUndirected()); //safety
 
-  if(m_nMove[src] < 0)
+  T used = UNUSED; //cell that becomes used
+
+  if(m_nMove[src] < 0){
     m_nMove[src] = dest;
+    used = src;
+  } //if
 
-  else if(m_nMove[dest] < 0)
+  else if(m_nMove[dest] < 0){
     m_nMove[dest] = src;
+    used = dest;
+  } //else if
 
   else return false;
 
+  if(m_bPadded)
+    UpdateExitCounts(used, -1);
+
   return true;
 } //InsertMove
 
@@ -498,7 +672,7 @@ bool CBaseBoard::InsertUndirectedMove(int src, int dest){
 /// \param dest The other end of move to insert.
 /// \return true if the insert was successful (the cells were unused).
 
-bool CBaseBoard::InsertDirectedMove(int src, int dest){
+template<class T> bool CBaseBoardT<T>::InsertDirectedMove(T src, T dest){
   assert(IsDirected()); //safety
 
   if(m_nMove[src] < 0)
@@ -525,15 +699,23 @@ bool CBaseBoard::InsertDirectedMove(int src, int dest){
 /// \param dest The other end of move to delete.
 /// \return true if the delete was successful (the move was there).
 
-bool CBaseBoard::DeleteMove(int src, int dest){ 
+template<class T> bool CBaseBoardT<T>::DeleteMove(T src, T dest){ 
   //delete move from primary move table
 
-  if(m_nMove[src] == dest) 
+  if(m_nMove[src] == dest){
     m_nMove[src] = UNUSED;
 
-  if(m_nMove[dest] == src) 
+    if(m_bPadded)
+      UpdateExitCounts(src, 1);
+  } //if
+
+  if(m_nMove[dest] == src){
     m_nMove[dest] = UNUSED;
 
+    if(m_bPadded)
+      UpdateExitCounts(dest, 1);
+  } //if
+
   //delete move from secondary move table
 
   if(IsDirected()){  
@@ -568,8 +750,8 @@ bool CBaseBoard::DeleteMove(int src, int dest){
 ///
 /// \param name Root of file name.
 
-void CBaseBoard::Save(std::string& name){
-  assert(IsUndirected()); //safety
+template<class T> void CBaseBoardT<T>::Save(std::string& name){
+  assert(IsUndirected() && !IsPadded()); //safety
 
   char buffer[256];
   sprintf_s(buffer, "%s.txt", name.c_str());
@@ -580,7 +762,7 @@ void CBaseBoard::Save(std::string& name){
   if(output != nullptr){
     for(UINT i=0; i<m_nHeight; i++){
       for(UINT j=0; j<m_nWidth; j++){
-        const int cell = i*m_nWidth + j;
+        const T cell = (T)i*m_nWidth + j;
         fprintf_s(output, "%d", GetMoveIndex(cell, m_nMove[cell]));
       } //for
       fprintf_s(output, "\n");
@@ -596,23 +778,23 @@ void CBaseBoard::Save(std::string& name){
 /// \param id [out]  Array of tourney identifiers, one for each cell.
 /// \return The number of cycles in the tourney.
 
-UINT CBaseBoard::GetTourneyIds(int*& id){
+template<class T> UINT CBaseBoardT<T>::GetTourneyIds(T*& id){
   UINT numcycles = 0; //number of cycles seen in tourney
 
-  for(UINT i=0; i<m_nSize; i++) //for each cell
+  for(T i=0; i<m_nSize; i++) //for each cell
     id[i] = UNUSED; //set identifier to indicate "no tourney"
 
-  for(UINT start=0; start<m_nSize; start++){ //for each start cell
+  for(T start=0; start<m_nSize; start++){ //for each start cell
     if(id[start] == UNUSED){ //if not already in a tourney
       id[start] = numcycles; //identify as in a new tourney
 
-      int prev = start; //previous cell
-      int cur = m_nMove[start]; //current cell
+      T prev = start; //previous cell
+      T cur = m_nMove[start]; //current cell
 
       while(CellIndexInRange(cur) && cur != start){ //while not closed
         id[cur] = numcycles; //identify each cell in the new cycle
         
-        const int dest0 = m_nMove[cur]; //dest0 move
+        const T dest0 = m_nMove[cur]; //dest0 move
 
         if(dest0 == prev){ //dest0 move in m_nMoveTable moves us back
           prev = cur;
@@ -638,10 +820,10 @@ UINT CBaseBoard::GetTourneyIds(int*& id){
 /// pixelization. Assumes that the board is undirected.
 /// \param name Root of file name.
 
-void CBaseBoard::SaveToSVG(std::string& name){  
-  assert(IsUndirected()); //safety
+template<class T> void CBaseBoardT<T>::SaveToSVG(std::string& name){  
+  assert(IsUndirected() && !IsPadded()); //safety
   
-  int* id = new int[m_nSize]; //tourney identifiers
+  T* id = new T[m_nSize]; //tourney identifiers
   const int numcycles = GetTourneyIds(id); //get tourney id for each cell
 
   char buffer[256];
@@ -653,7 +835,7 @@ void CBaseBoard::SaveToSVG(std::string& name){
   if(output != nullptr){
     const int w = m_nWidth; //shorthand
     const int h = m_nHeight; //shorthand
-    const int n = m_nSize; //shorthand
+    const T n = m_nSize; //shorthand
   
     const float cellsize = 16; //cell size
     const float spotsize = 2.8f; //spot size
@@ -709,13 +891,13 @@ void CBaseBoard::SaveToSVG(std::string& name){
 
     bool* used = new bool[n]; //whether cell has been used in a cycle
 
-    for(int i=0; i<n; i++) //mark all cells unused
+    for(T i=0; i<n; i++) //mark all cells unused
       used[i] = false;
 
     //Iterate through each cell. If that cell is unused then iterate
     //through the cells on the cycle that starts there.
 
-    for(int start=0; start<n; start++) //for each start cell
+    for(T start=0; start<n; start++) //for each start cell
       if(!used[start]){ //if not used in a previous cycle
         std::string polylinetag; //contents of polyline tag for current cycle
 
@@ -737,7 +919,7 @@ void CBaseBoard::SaveToSVG(std::string& name){
         
         polylinetag += "points=\""; //start the points list
 
-        int cur = start; //current cell
+        T cur = start; //current cell
 
         do{ //process current cell
           const float x = (cur%w + 0.5f)*cellsize; //cell x-coordinate
@@ -791,20 +973,35 @@ void CBaseBoard::SaveToSVG(std::string& name){
 /// Reader function for width.
 /// \return Width.
 
-int CBaseBoard::GetWidth(){
+template<class T> int CBaseBoardT<T>::GetWidth() const{
   return m_nWidth;
 } //GetWidth
 
 /// Reader function for height.
 /// \return Height.
 
-int CBaseBoard::GetHeight(){
+template<class T> int CBaseBoardT<T>::GetHeight() const{
   return m_nHeight;
 } //GetHeight
 
 /// Reader function for size (width times height).
 /// \return Size.
 
-int CBaseBoard::GetSize(){
+template<class T> T CBaseBoardT<T>::GetSize(){
   return m_nSize;
 } //GetSize
+
+/// Reader function for the number of entries in the move table, which is
+/// larger than the size of the board if the board is padded.
+/// \return Move table size.
+
+template<class T> T CBaseBoardT<T>::GetTableSize(){
+  return m_nTableSize;
+} //GetTableSize
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template class CBaseBoardT<int>; ///< Base chessboard with 32-bit cell indices.
+template class CBaseBoardT<INT64>; ///< Base chessboard with 64-bit cell indices.
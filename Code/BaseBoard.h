@@ -1,5 +1,5 @@
 /// \file BaseBoard.h
-/// \brief Header for the base chessboard CBaseBoard.
+/// \brief Header for the base chessboard CBaseBoardT.
 
 // MIT License
 //
@@ -63,74 +63,116 @@
 /// moving to cell j = m_nMove[j] until cell i is reached again. For a tourney,
 /// repeat this until all cells have been visited. For a closed knight's tour
 /// it is sufficient to do this once.
+///
+/// Knight's moves are found using a table of cell index offsets, one for each
+/// move index, together with a move mask for each cell recording which of
+/// those moves stay on the board. This saves us from dividing by the board
+/// width to find the row and column of a cell in the inner loops.
+///
+/// An undirected board can also be padded, that is, its move table can be
+/// surrounded by a border PADDING cells wide whose entries are BLOCKED. Every
+/// knight's move from a cell on a padded board then lands inside the move
+/// table, so a random walk can read the destination of a move without first
+/// checking that it is on the board. Cell indices on a padded board are
+/// indices into the padded move table. Use GetPaddedIndex() to find them and
+/// MakeUnpadded() to get back to the usual cell indices. A padded board also
+/// keeps a count of the available moves from each cell, which is updated
+/// whenever a move is inserted or deleted, so that GetAvailableMoveCount()
+/// is a table lookup.
+///
+/// The base chessboard is a template over the type of its cell indices, which
+/// is int for boards with fewer than \f$2^{31}\f$ cells and INT64 for larger
+/// ones. The typedef CBaseBoard is the 32-bit board, which is the one that is
+/// used unless the board is too large for it.
 
 #include "Random.h"
 
-class CBaseBoard{
+template<class T> class CBaseBoardT{
+  template<class U> friend class CBaseBoardT;
+
   protected:
     CRandom m_cRandom; ///< PRNG.
 
     UINT m_nWidth = 0; ///< Board width in cells.
     UINT m_nHeight = 0; ///< Board height in cells.
-    UINT m_nSize = 0; ///< Board size in cells.
+    T m_nSize = 0; ///< Board size in cells.
+    T m_nTableSize = 0; ///< Number of entries in the move tables.
+    bool m_bPadded = false; ///< Whether the move table has a sentinel border.
+
+    T* m_nMove = nullptr; ///< Primary move table.
+    T* m_nMove2 = nullptr; ///< Secondary move table.
 
-    int* m_nMove = nullptr; ///< Primary move table.
-    int* m_nMove2 = nullptr; ///< Secondary move table.
+    BYTE* m_nMoveMask = nullptr; ///< Moves that stay on the board, per cell.
+    int m_nMoveOffset[8] = {0}; ///< Cell index offset for each move index.
+    BYTE* m_nExitCount = nullptr; ///< Available moves per cell, padded only.
+
+    void BuildMoveTable(); ///< Build move mask and offset tables.
+    void BuildExitCounts(); ///< Build available move count table.
+    void UpdateExitCounts(T index, int delta); ///< Update around a cell.
 
     //helper functions
 
-    bool CellIndexInRange(int index); ///< Index in range test.
+    bool CellIndexInRange(T index) const; ///< Index in range test.
     bool InRangeX(int x); ///< X coordinate in range test.
     bool InRangeY(int y); ///< Y coordinate in range test.
 
-    bool IsMove(int i, int j); ///< Move test.
-    int GetDest(int i, const MoveDelta& delta); ///< Get destination of move.
+    bool IsMove(T i, T j); ///< Move test.
 
-    UINT GetTourneyIds(int*& id); ///< Get tourney identifier for each cell.
+    UINT GetTourneyIds(T*& id); ///< Get tourney identifier for each cell.
     
   public:
-    CBaseBoard(); ///< Constructor.
-    CBaseBoard(UINT n); ///< Constructor.
-    CBaseBoard(UINT w, UINT h); ///< Constructor.
-    CBaseBoard(int move[], UINT w, UINT h); ///< Constructor.
+    CBaseBoardT(); ///< Constructor.
+    CBaseBoardT(UINT n); ///< Constructor.
+    CBaseBoardT(UINT w, UINT h); ///< Constructor.
+    CBaseBoardT(const int move[], UINT w, UINT h); ///< Constructor.
 
-    ~CBaseBoard(); ///< Destructor.
+    ~CBaseBoardT(); ///< Destructor.
 
     void Clear(); ///< Clear the board of moves.
     
     void MakeDirected(); ///< Make into a directed board.
     void MakeUndirected(); ///< Make into an undirected board.
 
+    void MakePadded(); ///< Add a sentinel border to the move table.
+    void MakeUnpadded(); ///< Remove the sentinel border from the move table.
+    bool IsPadded() const; ///< Padded board test.
+    T GetPaddedIndex(T index); ///< Get index of cell in padded move table.
+
     bool IsTour(); ///< Knight's tour test.
     bool IsTourney(); ///< Tourney test.
     
-    bool IsDirected(); ///< Directed board test.
-    bool IsUndirected(); ///< Undirected board test.
-
-    bool IsKnightMove(int i, int j); ///< Knight's move test.
-    bool IsUnused(int index); ///< Test for unused cell.
-    bool IsUnused(int pos, const MoveDelta& delta); ///< Move is to unused cell.
-    bool IsOnBoard(int pos, const MoveDelta& delta); ///< Move stays on board.
+    bool IsDirected() const; ///< Directed board test.
+    bool IsUndirected() const; ///< Undirected board test.
+
+    bool IsKnightMove(T i, T j); ///< Knight's move test.
+    bool IsUnused(T index); ///< Test for unused cell.
+    bool IsUnused(T pos, int k); ///< Move is to unused cell.
+    bool IsOnBoard(T pos, int k); ///< Move stays on board.
+    T GetDest(T i, int k); ///< Get destination of move.
+    int GetMoveOffset(int k); ///< Get cell index offset of move.
     
-    int GetAvailableMoveCount(int index); ///< Get number of moves from a cell.
+    int GetAvailableMoveCount(T index); ///< Get number of moves from a cell.
 
-    bool InsertUndirectedMove(int src, int dest); ///< Insert an undirected move.
-    bool InsertDirectedMove(int src, int dest); ///< Insert a directed move.
-    bool DeleteMove(int src, int dest); ///< Delete a move.
+    bool InsertUndirectedMove(T src, T dest); ///< Insert an undirected move.
+    bool InsertDirectedMove(T src, T dest); ///< Insert a directed move.
+    bool DeleteMove(T src, T dest); ///< Delete a move.
 
     void Save(std::string& name); ///< Save board to a text file.
     void SaveToSVG(std::string& name); ///< Save to an SVG file.
 
-    int GetMoveIndex(int src, int dest); ///< Get move index.
+    int GetMoveIndex(T src, T dest); ///< Get move index.
     
-    void CopyToSubBoard(CBaseBoard& b, int x, int y); ///< Copy to sub-board.
+    void CopyToSubBoard(const CBaseBoardT<int>& b, int x, int y); ///< Copy to sub-board.
+
+    int GetWidth() const; ///< Get width.
+    int GetHeight() const; ///< Get height.
+    T GetSize(); ///< Get size.
+    T GetTableSize(); ///< Get move table size.
 
-    int GetWidth(); ///< Get width.
-    int GetHeight(); ///< Get height.
-    int GetSize(); ///< Get size.
+    T operator[](T index) const; ///< Get a move from the board.
+}; //CBaseBoardT
 
-    int operator[](int index); ///< Get a move from the board.
-}; //CBaseBoard
+typedef CBaseBoardT<int> CBaseBoard; ///< Base chessboard with 32-bit cell indices.
 
 #endif
 
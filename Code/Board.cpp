@@ -1,5 +1,5 @@
 /// \file Board.cpp
-/// \brief Code for the chessboard CBaseBoard.
+/// \brief Code for the chessboard CBoardT.
 
 // MIT License
 //
@@ -27,28 +27,25 @@
 
 #include "Defines.h"
 #include "Includes.h"
-#include "Graph.h"
-
-extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves. 
 
 /// Construct an empty board.
 
-CBoard::CBoard(){
+template<class T> CBoardT<T>::CBoardT(){
 } //constructor
 
 /// Construct a square undirected board.
 /// \param n Board width and height.
 
-CBoard::CBoard(UINT n): 
-  CBaseBoard(n){
+template<class T> CBoardT<T>::CBoardT(UINT n): 
+  CBaseBoardT<T>(n){
 } //constructor
 
 /// Construct a rectangular undirected board.
 /// \param w Board width.
 /// \param h Board height.
 
-CBoard::CBoard(UINT w, UINT h):
-  CBaseBoard(w, h){
+template<class T> CBoardT<T>::CBoardT(UINT w, UINT h):
+  CBaseBoardT<T>(w, h){
 } //constructor
 
 /// Construct an undirected board from a move table.
@@ -56,18 +53,18 @@ CBoard::CBoard(UINT w, UINT h):
 /// \param h Board height.
 /// \param move A \f$w \times h\f$ move table.
 
-CBoard::CBoard(int move[], UINT w, UINT h):
-  CBaseBoard(move, w, h){
+template<class T> CBoardT<T>::CBoardT(const int move[], UINT w, UINT h):
+  CBaseBoardT<T>(move, w, h){
 } //constructor
 
 /// Test whether a rail is valid, that is, all moves are knight's moves, the
 /// primary moves are present, and the cross moves are absent.
-/// Calls CBaseBoard::IsRail(int, int, int, int) to do the actual work.
+/// Calls IsRail(T, T, T, T) to do the actual work.
 /// \param r Rail to be tested.
 /// \return true if the rail is valid.
 
-bool CBoard::IsRail(CRail& r){
-  int s0, d0, s1, d1; //source and destination cells
+template<class T> bool CBoardT<T>::IsRail(CRailT<T>& r){
+  T s0, d0, s1, d1; //source and destination cells
 
   r.GetEdge0(s0, d0); //get them
   r.GetEdge1(s1, d1);
@@ -83,7 +80,7 @@ bool CBoard::IsRail(CRail& r){
 /// \param d1 Index of destination of second move.
 /// \return true if the cells form a rail.
 
-bool CBoard::IsRail(int s0, int d0, int s1, int d1){
+template<class T> bool CBoardT<T>::IsRail(T s0, T d0, T s1, T d1){
   return 
     IsKnightMove(s0, d0) && IsKnightMove(s1, d1) && //primary knight's moves
     IsKnightMove(s0, s1) && IsKnightMove(d0, d1) && //cross knight's moves
@@ -134,38 +131,180 @@ bool CBoard::IsRail(int s0, int d0, int s1, int d1){
 /// perform the respective checks when one of the moves from cell \f$i\f$ has
 /// index \f$5\f$, \f$6\f$, or \f$7\f$.
 ///
+/// The board is scanned in row bands by ScanRails(), possibly in parallel.
 /// The rail list is permuted into random order before returning.
 ///
 /// \param rails [out] Rail list.
+/// \param pPool Pointer to a thread pool to scan with, if any.
 
-void CBoard::FindRails(std::vector<CRail>& rails){
+template<class T> 
+void CBoardT<T>::FindRails(std::vector<CRailT<T>>& rails, CThreadPool* pPool){
   assert(IsDirected()); //safety
 
-  for(int s0=0; s0<(int)m_nSize; s0++) //source of move 0
-    for(int d0: {m_nMove[s0], m_nMove2[s0]}){ //destination of move 0
-      const int i = GetMoveIndex(s0, d0); //index of move 0
-      
-      if(i >= 4) //move 0 is forwards wrt the first for-loop
-        for(int j=4; j<8; j++) //downwards cross move from s0
-          if(i != j){ //eliminate the only forwards move that isn't a rail
-            const int s1 = GetDest(s0, g_vecDeltas[j]); //source of move 1
-
-            if(s1 != UNUSED) //move 1 stays on board
-              for(int d1: {m_nMove[s1], m_nMove2[s1]}) //destination of move 1
-                if(IsRail(s0, d0, s1, d1)) //we have a rail
-                  rails.push_back(CRail(s0, d0, s1, d1, m_nWidth)); //record it
+  ScanRails(rails, nullptr, nullptr, nullptr, pPool);
+  Shuffle(rails);
+} //FindRails
+
+/// Find the rails whose first move has a given source cell, as described in
+/// FindRails(std::vector<CRailT<T>>&), and append them to a rail list.
+/// If the sets of cycles that have been joined are given, then only the
+/// rails between different sets are appended, since switching any other
+/// rail would split a cycle. Assumes that the board is directed.
+/// \param s0 Source of move 0.
+/// \param rails [in, out] Rail list.
+/// \param id Original cycle identifier for each cell, or nullptr.
+/// \param cycles Sets of original cycles that have been joined, or nullptr.
+
+template<class T> void CBoardT<T>::FindRails(T s0, std::vector<CRailT<T>>& rails,
+  T* id, const CUnionFind* cycles)
+{
+  for(T d0: {m_nMove[s0], m_nMove2[s0]}){ //destination of move 0
+    const int i = GetMoveIndex(s0, d0); //index of move 0
+    
+    if(i >= 4) //move 0 is forwards wrt the for-loop in FindRails
+      for(int j=4; j<8; j++) //downwards cross move from s0
+        if(i != j){ //eliminate the only forwards move that isn't a rail
+          const T s1 = GetDest(s0, j); //source of move 1
+
+          if(s1 != UNUSED && //move 1 stays on board
+            (cycles == nullptr || //and is in a different set from move 0
+              cycles->GetRoot((UINT)id[s0]) != cycles->GetRoot((UINT)id[s1])))
+          {
+            for(T d1: {m_nMove[s1], m_nMove2[s1]}) //destination of move 1
+              if(IsRail(s0, d0, s1, d1)) //we have a rail
+                rails.push_back(CRailT<T>(s0, d0, s1, d1)); //record it
           } //if
+        } //if
+  } //for
+} //FindRails
+
+/// Find the rails that may join cycles that are in different sets. Only a
+/// rail between two different sets can help, so at least one end of it must
+/// lie outside the largest set. If the largest set has most of the cycles,
+/// then the cycles in the other sets are walked to mark their cells and the
+/// cells a knight's move away from them, and the rails are found only from
+/// the marked cells. Otherwise, or if that marks more than half of the
+/// board, then the whole board is scanned in order, which is faster. The
+/// rail list is permuted into random order before returning. Assumes that
+/// the board is directed.
+/// \param rails [out] Rail list.
+/// \param id Original cycle identifier for each cell.
+/// \param start A cell in each of the original cycles.
+/// \param cycles Sets of original cycles that have been joined.
+/// \param pPool Pointer to a thread pool to scan with, if any.
+
+template<class T> void CBoardT<T>::FindRails(std::vector<CRailT<T>>& rails,
+  T* id, std::vector<T>& start, CUnionFind& cycles, CThreadPool* pPool)
+{
+  assert(IsDirected()); //safety
+
+  const UINT n = (UINT)start.size(); //number of original cycles
+  UINT largest = 0; //root of largest set
+
+  for(UINT i=0; i<n; i++){
+    const UINT root = cycles.Find(i);
+
+    if(cycles.GetSetSize(root) > cycles.GetSetSize(largest))
+      largest = root;
+  } //for
+
+  bool bWalk = cycles.GetSetSize(largest) > n/2; //whether to walk cycles
+  std::vector<bool> marked; //whether a cell is a candidate source
+
+  if(bWalk){
+    std::vector<bool> walked(n, false); //whether a set has been walked
+    marked.resize(m_nSize, false);
+    T count = 0; //number of marked cells
+
+    for(UINT i=0; i<n && count <= m_nSize/2; i++){
+      const UINT root = cycles.Find(i);
+
+      if(root != largest && !walked[root]){ //walk cycle containing start[i]
+        walked[root] = true;
+        
+        T prev = UNUSED; //previous cell
+        T cur = start[i]; //current cell
+
+        do{
+          for(int k=-1; k<8; k++){ //current cell and its knight's neighbors
+            const T c = (k < 0)? cur: GetDest(cur, k);
+
+            if(c != UNUSED && !marked[c]){
+              marked[c] = true;
+              count++;
+            } //if
+          } //for
+
+          const T next = (m_nMove[cur] == prev)? m_nMove2[cur]: m_nMove[cur];
+          prev = cur;
+          cur = next;
+        }while(cur != start[i] && cur != UNUSED);
+      } //if
     } //for
 
-  //randomize the rail list by applying a pseudo-random permutation
-  //using the standard random permutation generation algorithm
-  
-  const int n = (int)rails.size(); //number of rails
+    bWalk = count <= m_nSize/2; //not worth it if too many cells are marked
+  } //if
 
-  for(int i=0; i<n; i++) //yes, the indices on the next line are correct...
-    std::swap(rails[i], rails[m_cRandom.randn(i, n - 1)]); //...because math
+  cycles.Flatten(); //so that the threads can find roots quickly
+  ScanRails(rails, id, &cycles, bWalk? &marked: nullptr, pPool);
+  Shuffle(rails);
 } //FindRails
 
+/// Find the rails from every source cell, or from the marked ones if there
+/// are any. The board is divided into bands of rows, one for each thread in
+/// the thread pool, with at least the grain size in cells in each band. Each
+/// band's rails are collected into a rail list of its own, and these are
+/// appended in order of band, so the result doesn't depend on the number of
+/// threads. Assumes that the board is directed.
+/// \param rails [in, out] Rail list.
+/// \param id Original cycle identifier for each cell, or nullptr.
+/// \param cycles Sets of original cycles that have been joined, or nullptr.
+/// \param marked Whether each cell is a candidate source, or nullptr.
+/// \param pPool Pointer to a thread pool to scan with, or nullptr.
+
+template<class T> void CBoardT<T>::ScanRails(std::vector<CRailT<T>>& rails,
+  T* id, const CUnionFind* cycles, const std::vector<bool>* marked, 
+  CThreadPool* pPool)
+{
+  const T nThreads = (pPool == nullptr)? 1: pPool->GetNumThreads(); //threads
+  const int k = (int)std::max((T)1, //number of bands
+    std::min(nThreads, m_nSize/m_nGrainSize));
+
+  std::vector<std::vector<CRailT<T>>> bands(k); //rail lists for other bands
+
+  auto scan = [&](int i, std::vector<CRailT<T>>& result){ //scan band i
+    const T first = (T)(i*(UINT64)m_nHeight/k)*m_nWidth; //first cell
+    const T last = (T)((i + 1)*(UINT64)m_nHeight/k)*m_nWidth; //past last cell
+
+    for(T s0=first; s0<last; s0++) //source of move 0
+      if(marked == nullptr || (*marked)[s0])
+        FindRails(s0, result, id, cycles);
+  }; //scan
+
+  if(k == 1)scan(0, rails); //one band, so scan it in this thread
+
+  else{ //scan the bands in the thread pool, the first one into rails
+    pPool->Run(k, [&](int i){scan(i, (i == 0)? rails: bands[i]);});
+
+    for(int i=1; i<k; i++) //append the other bands in order
+      rails.insert(rails.end(), bands[i].begin(), bands[i].end());
+  } //else
+} //ScanRails
+
+/// Randomize a rail list by applying a pseudo-random permutation
+/// using the standard random permutation generation algorithm.
+/// \param rails [in, out] Rail list.
+
+template<class T> void CBoardT<T>::Shuffle(std::vector<CRailT<T>>& rails){
+  const T n = (T)rails.size(); //number of rails
+  const bool bLarge = (UINT64)n > UINT_MAX; //too many rails for randn()
+
+  for(T i=0; i<n; i++){ //yes, the indices on the next lines are correct...
+    const T j = bLarge? (T)m_cRandom.randn64(i, n - 1): m_cRandom.randn(i, n - 1);
+    std::swap(rails[i], rails[j]); //...because math
+  } //for
+} //Shuffle
+
 /// Switch a rail. Assumes that the board is directed. The rails in the top row
 /// of this image get switched to the corresponding rails in the bottom row 
 /// (and vice-versa).
@@ -174,10 +313,10 @@ void CBoard::FindRails(std::vector<CRail>& rails){
 ///
 /// \param r A rail.
 
-void CBoard::Switch(CRail& r){
+template<class T> void CBoardT<T>::Switch(CRailT<T>& r){
   assert(IsDirected()); //safety
 
-  int s0, d0, s1, d1; //rail vertices
+  T s0, d0, s1, d1; //rail vertices
 
   r.GetEdge0(s0, d0); //rail edge
   r.GetEdge1(s1, d1); //rail edge
@@ -193,116 +332,211 @@ void CBoard::Switch(CRail& r){
   InsertDirectedMove(d0, d1);
 } //Switch
 
-/// Shatter a tourney by switching a set of non-overlapping rails.
-/// Assumes that the board is directed.
+/// Shatter a tourney by switching a set of non-overlapping rails. Assumes
+/// that the board is directed and not padded. The rails, which are in random
+/// order, are switched in that order if they are still rails when their turn
+/// comes, but they are first partitioned by the row of their first cell
+/// into bands of rows. The cells of a rail lie in six consecutive rows, so
+/// rails in bands that are not adjacent share no cells. Since whether a rail
+/// is still a rail depends only on the moves from its own cells, and
+/// switching it changes only those, the even-numbered bands can be done in
+/// parallel, followed by the odd-numbered bands. The bands don't depend on
+/// the number of threads, so neither does the result.
+/// \param pPool Pointer to a thread pool to use, if any.
 
-void CBoard::Shatter(){ 
-  assert(IsDirected()); //safety
+template<class T> void CBoardT<T>::Shatter(CThreadPool* pPool){ 
+  assert(IsDirected() && !IsPadded()); //safety
 
-  std::vector<CRail> rails; //rail list
-  FindRails(rails); //find rails and put them in the rail list
-  
-  for(CRail& r: rails) //for each rail
-    if(IsRail(r)) //if it's still a rail, that is, it hasn't been flipped
-      Switch(r); //flip it
+  std::vector<CRailT<T>> rails; //rail list
+  FindRails(rails, pPool); //find rails and put them in the rail list
+
+  //partition the rails into bands, keeping them in order within each band
+
+  const int rows = (int)std::max((UINT)m_nMinBandHeight, //rows per band
+    m_nGrainSize/m_nWidth);
+  const int n = (m_nHeight + rows - 1)/rows; //number of bands
+
+  std::vector<std::vector<CRailT<T>>> bands(n); //rail lists for the bands
+
+  for(CRailT<T>& r: rails){ //for each rail
+    T s0, d0; //first rail edge
+    r.GetEdge0(s0, d0);
+    bands[(int)(s0/m_nWidth)/rows].push_back(r); 
+  } //for
+
+  std::vector<CRailT<T>>().swap(rails); //free up the rail list
+
+  //switch the rails in the even bands, then in the odd bands
+
+  auto flip = [&](int first, int stride){ //flip rails in every stride-th band
+    for(int i=first; i<n; i+=stride)
+      for(CRailT<T>& r: bands[i]) //for each rail in band i
+        if(IsRail(r)) //if it's still a rail, that is, it hasn't been flipped
+          Switch(r); //flip it
+  }; //flip
+
+  const int nThreads = (pPool == nullptr)? 1: pPool->GetNumThreads(); //threads
+
+  for(int parity=0; parity<2; parity++){
+    const int k = std::max(1, std::min(nThreads, (n - parity + 1)/2)); //threads
+
+    if(k == 1)flip(parity, 2); //flip bands in this thread
+    else pPool->Run(k, [&](int i){flip(parity + 2*i, 2*k);});
+  } //for
 } //Shatter
 
+/// Count the moves of each move index on a directed board. Each move is
+/// counted from both of its ends, so the counts add up to twice the number
+/// of moves.
+/// \param count [out] Number of moves with each move index.
+
+template<class T> void CBoardT<T>::GetMoveCounts(UINT64 count[8]){
+  assert(IsDirected()); //safety
+
+  for(int k=0; k<8; k++)
+    count[k] = 0;
+
+  for(T i=0; i<m_nSize; i++) //for each cell
+    for(T dest: {m_nMove[i], m_nMove2[i]}){ //for each move from it
+      const int k = GetMoveIndex(i, dest); //move index
+
+      if(k != UNUSED)
+        count[k]++;
+    } //for
+} //GetMoveCounts
+
 /// Obfuscate a tourney by shattering it a few times. The board can be directed
 /// or undirected initially, but it will be undirected after obfuscating. The
-/// result should be a knight's tour in most cases.
+/// result should be a knight's tour in most cases. If the pieces can't all
+/// be joined, the board is shattered again and rejoined, up to the maximum
+/// number of adaptive shatters. In adaptive mode the board is shattered
+/// until the distribution of move indices stops changing, that is, until
+/// the total variation distance between the distributions before and after
+/// a shatter is below the mixing tolerance, or until a maximum number of
+/// shatters is reached. Since the distance fluctuates by a small multiple of
+/// \f$1/\sqrt{n}\f$ on an \f$n\f$-cell board even when it is well mixed, the
+/// tolerance is never less than \f$4/\sqrt{n}\f$. If the cancellation token
+/// is cancelled, obfuscation stops after the current shatter or round of
+/// joins.
+/// \param nRounds Number of shatters, or ADAPTIVE to shatter until mixed.
+/// \param pPool Pointer to a thread pool to use, if any.
+/// \param pCancel Pointer to a cancellation token, if any.
+
+template<class T> void CBoardT<T>::Obfuscate(int nRounds, CThreadPool* pPool,
+  const CCancelToken* pCancel)
+{
+  auto cancelled = [&]{return pCancel != nullptr && pCancel->IsCancelled();};
+  if(cancelled())return; //bail out, don't waste time on an abandoned board
 
-void CBoard::Obfuscate(){
   MakeDirected(); //need a directed board
   
-  for(int i=0; i<16; i++)
-    Shatter();
+  if(nRounds != ADAPTIVE)
+    for(int i=0; i<nRounds && !cancelled(); i++)
+      Shatter(pPool);
+
+  else{ //shatter until the move distribution plateaus
+    const double tolerance = std::max((double)m_fMixingTolerance, //mixing tolerance
+      4.0/sqrt((double)m_nSize));
+
+    UINT64 prev[8], count[8]; //move counts before and after a shatter
+    GetMoveCounts(prev);
+
+    for(int i=0; i<m_nMaxShatterRounds && !cancelled(); i++){
+      Shatter(pPool);
+      GetMoveCounts(count);
+
+      UINT64 delta = 0; //total change in move counts
 
-  JoinUntilTour();
+      for(int k=0; k<8; k++){
+        delta += (count[k] > prev[k])? count[k] - prev[k]: prev[k] - count[k];
+        prev[k] = count[k];
+      } //for
+
+      const double change = delta/(4.0*m_nSize); //total variation distance
+      if(i + 1 >= m_nMinShatterRounds && change < tolerance)
+        break; //it's mixed
+    } //for
+  } //else
+
+  JoinUntilTour(pPool, pCancel);
+
+  for(int i=0; i<m_nMaxShatterRounds && !cancelled() && !IsTour(); i++){ 
+    Shatter(pPool); //rails ran out, so shatter again for fresh ones
+    JoinUntilTour(pPool, pCancel);
+  } //for
 
   MakeUndirected(); //make it undirected before returning
 } //Obfuscate
 
 /// Join a tourney, that is, attempt to make it into a knight's tour by 
-/// switching rails. Assumes that the tourney is directed. First a rail
-/// (multi-) graph is created with a vertex for each tourney and an edge for
-/// each cell-disjoint rail that connects them. Switching the rails in a
+/// switching rails. Assumes that the tourney is directed. Consider the rail
+/// (multi-) graph, which has a vertex for each tourney and an edge for
+/// each rail that connects two of them. Switching the rails in a
 /// spanning forest of the rail graph connects up as many cycles as it can
 /// (which may may not necessarily result in a knight's tour). For example, the
 /// following image shows the rail graph of a tourney at left. The numbers on
 /// the edges indicate the number of cell-disjoint rails that intersect two
-/// cycles. A breadth-first spanning tree of this graph is shown on the right.
+/// cycles. A spanning tree of this graph is shown on the right.
 ///
 /// \image html bfst22.png
 ///
-/// \return true if the join succeeeded.
-
-bool CBoard::Join(){
-  std::vector<CRail> rails; //rail list.
-  FindRails(rails); //find rails and put them in the rail list
-
-  //get tourney identifiers for each cell
-  
-  int* id = new int[m_nSize]; //tourney identifiers
-  const UINT numcycles = GetTourneyIds(id); //get tourney id for each cell
-  if(numcycles == 1)return true; //bail out, we're good
-
-  //construct the rail graph
-
-  bool* used = new bool[m_nSize];
-
-  for(UINT i=0; i<m_nSize; i++)
-    used[i] = false;
+/// The rail graph is not built explicitly. Instead, a random spanning forest
+/// is found using Kruskal's algorithm on the rails, which FindRails() has
+/// already put into random order, with a union-find structure over the
+/// tourneys. A rail is switched if its cells are not used by a rail that has
+/// already been switched and it connects two tourneys that have not yet been
+/// joined. Switching a rail between two cycles makes them into one cycle,
+/// so afterwards the sets in the union-find structure are the cycles.
+///
+/// \param rails Rail list in random order.
+/// \param id Original cycle identifier for each cell.
+/// \param cycles [in, out] Sets of original cycles that have been joined.
 
-  CGraph g(numcycles); //rail graph
-  UINT count = 0;
-  std::vector<UINT> vecEdgeToRail;
+template<class T> void CBoardT<T>::Join(std::vector<CRailT<T>>& rails, T* id,
+  CUnionFind& cycles)
+{
+  std::vector<bool> used(m_nSize, false); //cells in switched rails
 
   for(auto& r: rails){ //for each rail
-    int src0, dest0, src1, dest1; //rail vertices
+    T src0, dest0, src1, dest1; //rail vertices
 
     r.GetEdge0(src0, dest0); //rail edge
     r.GetEdge1(src1, dest1); //rail edge
 
     if(!used[src0] && !used[dest0] && !used[src1] && !used[dest1]){
-      const int idsrc0 = id[src0]; //id of tourney that src0 is in
-      const int iddest0 = id[dest0]; //id of tourney that dest0 is in
+      const UINT idsrc0 = cycles.Find((UINT)id[src0]); //cycle src0 is in
+      const UINT iddest0 = cycles.Find((UINT)id[dest0]); //cycle dest0 is in
 
-      const int idsrc1 = id[src1]; //id of tourney that src1 is in
-      const int iddest1 = id[dest1]; //id of tourney that dest1 is in
+      const UINT idsrc1 = cycles.Find((UINT)id[src1]); //cycle src1 is in
+      const UINT iddest1 = cycles.Find((UINT)id[dest1]); //cycle dest1 is in
 
-      if(idsrc0 == iddest0 && idsrc1 == iddest1 && idsrc0 != idsrc1){ 
-        //rail connects tourneys
-        g.InsertEdge(idsrc0, idsrc1); //add rail edge to rail graph
+      if(idsrc0 == iddest0 && idsrc1 == iddest1 && 
+        cycles.Union(idsrc0, idsrc1)) //rail joins two cycles
+      {
+        Switch(r); //switch a spanning forest rail
         used[src0] = used[src1] = used[dest0] = used[dest1] = true;
-        vecEdgeToRail.push_back(count); 
       } //if
     } //if
-
-    count++;
   } //for
-
-  delete [] used;
-  delete [] id; 
-
-  //g.PrintGraph(); //uncomment to output a graph so you can make a figure
-
-  //switch rails in a spanning tree of the rail graph
-
-  std::vector<UINT> spanningforest; //rails in spanning forest of rail graph
-  const UINT numtrees = g.BFSF(spanningforest); 
-
-  for(UINT i: spanningforest){ //for each rail in the spanning forest
-    UINT j = vecEdgeToRail[i]; //index of rail in rail list
-    Switch(rails[j]); //switch a spanning tree rail
-  } //for
-
-  return numtrees == 1;
 } //Join
 
-/// Join a tourney until it becomes a knight's tour. Maintains directedness. 
-/// Uses Join() to do the heavy lifting.
+/// Join a tourney until it becomes a knight's tour, or until no rail joins
+/// two of the remaining cycles or the cancellation token is cancelled, in
+/// which case the board is left a tourney. Maintains directedness. 
+/// Uses Join() to do the heavy lifting. The cycles are found once, at the
+/// start. After each round of joins the cycles are known from the
+/// union-find structure, so each round only keeps the rails between
+/// different cycles, and once most of the original cycles have been joined
+/// it only looks for them near the cycles outside the largest one.
+/// \param pPool Pointer to a thread pool to find rails with, if any.
+/// \param pCancel Pointer to a cancellation token, if any.
+
+template<class T> void CBoardT<T>::JoinUntilTour(CThreadPool* pPool, 
+  const CCancelToken* pCancel)
+{
+  if(pCancel != nullptr && pCancel->IsCancelled())
+    return; //bail out, don't waste time on an abandoned board
 
-void CBoard::JoinUntilTour(){
   if(IsTour())return; //bail out, it's a knight's tour already
 
   //make board directed, if it isn't already
@@ -314,13 +548,44 @@ void CBoard::JoinUntilTour(){
     MakeDirected();
   } //if
 
-  bool bIsTour = false;
-  
-  while(!bIsTour)
-    bIsTour = Join();
+  //get cycle identifiers for each cell and a cell in each cycle
+
+  T* id = new T[m_nSize]; //cycle identifiers
+  const UINT numcycles = GetTourneyIds(id); //get cycle id for each cell
+  std::vector<T> start(numcycles, UNUSED); //a cell in each cycle
+
+  for(T i=m_nSize-1; i>=0; i--)
+    start[(UINT)id[i]] = i;
+
+  //join until there is only one cycle
+
+  CUnionFind cycles(numcycles); //cycles joined so far
+  std::vector<CRailT<T>> rails; //rail list
+
+  while(cycles.GetNumSets() > 1 && 
+    (pCancel == nullptr || !pCancel->IsCancelled()))
+  {
+    const UINT sets = cycles.GetNumSets(); //number of cycles before this round
+
+    rails.clear();
+    FindRails(rails, id, start, cycles, pPool); //rails between cycles
+    Join(rails, id, cycles);
+
+    if(cycles.GetNumSets() == sets) //no rail joins two cycles, so stuck
+      break;
+  } //while
 
   //clean up and exit
 
+  delete [] id;
+
   if(bWasUndirected) //if the board came in to this function undirected
     MakeUndirected(); //make it undirected again
 } //JoinUntilTour
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template class CBoardT<int>; ///< Chessboard with 32-bit cell indices.
+template class CBoardT<INT64>; ///< Chessboard with 64-bit cell indices.
@@ -1,5 +1,5 @@
 /// \file Board.h
-/// \brief Header for the chessboard CBoard.
+/// \brief Header for the chessboard CBoardT.
 
 // MIT License
 //
@@ -31,34 +31,87 @@
 #include "Helpers.h"
 #include "Rail.h"
 #include "BaseBoard.h"
+#include "UnionFind.h"
+#include "ThreadPool.h"
 
 /// \brief Chessboard.
 ///
 /// CBoard adds to CBaseBoard the additional functionality needed to shatter,
 /// join, and obfuscate tourneys. It contains an implementation of the new
-/// algorithms presented in the paper.
+/// algorithms presented in the paper. Like CBaseBoardT, it is a template
+/// over the type of its cell indices.
 
-class CBoard: public CBaseBoard{
+template<class T> class CBoardT: public CBaseBoardT<T>{
   private:
-    void FindRails(std::vector<CRail>& rails); ///< Find all rails.
-    void Switch(CRail& r); ///< Switch a rail.
+    //names from the base class template
 
-    bool IsRail(int s0, int d0, int s1, int d1); ///< Rail test.
-    bool IsRail(CRail& r); ///< Rail test.
+    using CBaseBoardT<T>::m_cRandom;
+    using CBaseBoardT<T>::m_nWidth;
+    using CBaseBoardT<T>::m_nHeight;
+    using CBaseBoardT<T>::m_nSize;
+    using CBaseBoardT<T>::m_nMove;
+    using CBaseBoardT<T>::m_nMove2;
 
-    bool Join(); ///< Join cycles to reduce tourney size.
+    using CBaseBoardT<T>::IsMove;
+    using CBaseBoardT<T>::IsPadded;
+    using CBaseBoardT<T>::GetTourneyIds;
+
+    static const int m_nGrainSize = 1 << 16; ///< Smallest area for a thread.
+    static const int m_nMinBandHeight = 8; ///< Fewest rows in a shatter band.
+
+    static const int m_nMinShatterRounds = 2; ///< Fewest adaptive shatters.
+    static const int m_nMaxShatterRounds = 64; ///< Most adaptive shatters.
+    static constexpr double m_fMixingTolerance = 0.001; ///< Mixing tolerance.
+
+    void FindRails(std::vector<CRailT<T>>& rails, 
+      CThreadPool* pPool=nullptr); ///< Find all rails.
+    void FindRails(std::vector<CRailT<T>>& rails, T* id, 
+      std::vector<T>& start, CUnionFind& cycles, 
+      CThreadPool* pPool=nullptr); ///< Find rails between sets.
+    void FindRails(T s0, std::vector<CRailT<T>>& rails, T* id=nullptr, 
+      const CUnionFind* cycles=nullptr); ///< Find rails at s0.
+    void ScanRails(std::vector<CRailT<T>>& rails, T* id, 
+      const CUnionFind* cycles, const std::vector<bool>* marked,
+      CThreadPool* pPool); ///< Find rails in row bands.
+    void Shuffle(std::vector<CRailT<T>>& rails); ///< Shuffle rails.
+    void GetMoveCounts(UINT64 count[8]); ///< Count moves of each index.
+    void Switch(CRailT<T>& r); ///< Switch a rail.
+
+    bool IsRail(T s0, T d0, T s1, T d1); ///< Rail test.
+    bool IsRail(CRailT<T>& r); ///< Rail test.
+
+    void Join(std::vector<CRailT<T>>& rails, T* id, 
+      CUnionFind& cycles); ///< Join cycles to reduce tourney size.
     
   public:
-    CBoard(); ///< Constructor.
-    CBoard(UINT n); ///< Constructor.
-    CBoard(UINT w, UINT h); ///< Constructor.
-    CBoard(int move[], UINT w, UINT h); ///< Constructor.
+    //names from the base class template
+
+    using CBaseBoardT<T>::IsDirected;
+    using CBaseBoardT<T>::IsUndirected;
+    using CBaseBoardT<T>::MakeDirected;
+    using CBaseBoardT<T>::MakeUndirected;
+    using CBaseBoardT<T>::IsTour;
+    using CBaseBoardT<T>::IsKnightMove;
+    using CBaseBoardT<T>::GetMoveIndex;
+    using CBaseBoardT<T>::GetDest;
+    using CBaseBoardT<T>::DeleteMove;
+    using CBaseBoardT<T>::InsertDirectedMove;
+
+    CBoardT(); ///< Constructor.
+    CBoardT(UINT n); ///< Constructor.
+    CBoardT(UINT w, UINT h); ///< Constructor.
+    CBoardT(const int move[], UINT w, UINT h); ///< Constructor.
+
+    void Shatter(CThreadPool* pPool=nullptr); ///< Shatter tourneys into more tourneys.
+    void JoinUntilTour(CThreadPool* pPool=nullptr, 
+      const CCancelToken* pCancel=nullptr); ///< Join cycles to reduce tourney size.
 
-    void Shatter(); ///< Shatter tourneys into more tourneys.
-    void JoinUntilTour(); ///< Join cycles to reduce tourney size.
+    void Obfuscate(int nRounds=SHATTER_ROUNDS, CThreadPool* pPool=nullptr,
+      const CCancelToken* pCancel=nullptr); ///< Obfuscate function.
+}; //CBoardT
 
-    void Obfuscate(); ///< Obfuscate function.
-}; //CBoard
+typedef CBoardT<int> CBoard; ///< Chessboard with 32-bit cell indices.
+typedef CBoardT<INT64> CLargeBoard; ///< Chessboard with 64-bit cell indices.
 
 #endif
 
@@ -0,0 +1,136 @@
+/// \file BoundedQueue.cpp
+/// \brief Code for the bounded lock-free queue CBoundedQueue.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "BoundedQueue.h"
+#include "Structs.h"
+
+/// Create the ring buffer and number its slots for the first lap.
+/// \param n Capacity, which is rounded up to a power of 2.
+
+template <class data> CBoundedQueue<data>::CBoundedQueue(size_t n):
+  m_nTail(0), m_nHead(0)
+{
+  size_t capacity = 2; //capacity, a power of 2
+
+  while(capacity < n)
+    capacity <<= 1;
+
+  m_nMask = capacity - 1;
+  m_pCell = new CCell[capacity];
+
+  for(size_t i=0; i<capacity; i++)
+    m_pCell[i].m_nSequence.store(i, std::memory_order_relaxed);
+} //constructor
+
+/// Delete the ring buffer.
+
+template <class data> CBoundedQueue<data>::~CBoundedQueue(){
+  delete [] m_pCell;
+} //destructor
+
+/// Insert an element at the tail of the queue unless the queue is full.
+/// A slot is ready for a push when its sequence number equals the tail
+/// position. Setting the sequence number to one more than that afterwards
+/// publishes the element to pop().
+/// \param element An element.
+/// \return true If there was room for the element.
+
+template <class data> bool CBoundedQueue<data>::try_push(const data& element){
+  size_t pos = m_nTail.load(std::memory_order_relaxed); //tail position
+
+  while(true){
+    CCell& cell = m_pCell[pos & m_nMask]; //slot at the tail
+    const size_t seq = cell.m_nSequence.load(std::memory_order_acquire);
+    const ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)pos; //lap difference
+
+    if(diff == 0){ //slot is free on this lap
+      if(m_nTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+        cell.m_tData = element;
+        cell.m_nSequence.store(pos + 1, std::memory_order_release);
+        return true;
+      } //if
+    } //if
+
+    else if(diff < 0) //slot not yet popped on the last lap, so full
+      return false;
+
+    else pos = m_nTail.load(std::memory_order_relaxed); //another push got here first
+  } //while
+} //try_push
+
+/// Insert an element at the tail of the queue, yielding to other threads
+/// for as long as the queue is full.
+/// \param element An element.
+
+template <class data> void CBoundedQueue<data>::push(const data& element){
+  while(!try_push(element))
+    std::this_thread::yield(); //wait for a consumer to make room
+} //push
+
+/// Delete and return the element at the head of the queue. A slot is ready
+/// for a pop when its sequence number is one more than the head position.
+/// Setting it to the head position plus the capacity afterwards frees the
+/// slot for the push on the next lap.
+/// \param element [out] The element deleted.
+/// \return true If there was an element to delete.
+
+template <class data> bool CBoundedQueue<data>::pop(data& element){
+  size_t pos = m_nHead.load(std::memory_order_relaxed); //head position
+
+  while(true){
+    CCell& cell = m_pCell[pos & m_nMask]; //slot at the head
+    const size_t seq = cell.m_nSequence.load(std::memory_order_acquire);
+    const ptrdiff_t diff = (ptrdiff_t)seq - (ptrdiff_t)(pos + 1); //lap difference
+
+    if(diff == 0){ //slot has been filled on this lap
+      if(m_nHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+        element = cell.m_tData;
+        cell.m_nSequence.store(pos + m_nMask + 1, std::memory_order_release);
+        return true;
+      } //if
+    } //if
+
+    else if(diff < 0) //slot not yet pushed on this lap, so empty
+      return false;
+
+    else pos = m_nHead.load(std::memory_order_relaxed); //another pop got here first
+  } //while
+} //pop
+
+/// Get the number of things in the queue. This is only a snapshot if other
+/// threads are pushing or popping.
+/// \return the number of things in the queue.
+
+template <class data> size_t CBoundedQueue<data>::size(){
+  const size_t head = m_nHead.load(std::memory_order_acquire); //head position
+  const size_t tail = m_nTail.load(std::memory_order_acquire); //tail position
+  return tail > head? tail - head: 0;
+} //size
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template class CBoundedQueue<CSearchResult>; ///< Bounded queue of results.
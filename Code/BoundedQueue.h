@@ -0,0 +1,70 @@
+/// \file BoundedQueue.h
+/// \brief Header for the bounded lock-free queue CBoundedQueue.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __BoundedQueue__
+#define __BoundedQueue__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Bounded lock-free queue.
+///
+/// A thread-safe queue of fixed capacity for any number of producer and
+/// consumer threads, stored in a ring buffer and using no mutex. Each slot
+/// in the ring has a sequence number that says whether it is ready to be
+/// written or to be read on the current lap of the ring, so a thread
+/// claims a slot with one compare-and-swap on the head or tail position.
+/// Memory use is fixed however many elements pass through the queue. When
+/// the queue is full, push() yields until a consumer has made room, which
+/// applies back-pressure to producers that get ahead of the consumer.
+
+template<class data> class CBoundedQueue{ 
+  private:
+    /// \brief One slot in the ring buffer.
+
+    struct CCell{
+      std::atomic<size_t> m_nSequence; ///< Sequence number.
+      data m_tData; ///< Contents.
+    }; //CCell
+
+    CCell* m_pCell = nullptr; ///< Ring buffer.
+    size_t m_nMask = 0; ///< Capacity minus one, for wrapping positions.
+
+    char m_cPadding0[64]; ///< Keeps the tail off the ring pointer's cache line.
+    std::atomic<size_t> m_nTail; ///< Position of the next push.
+    char m_cPadding1[64]; ///< Keeps the head and tail on different cache lines.
+    std::atomic<size_t> m_nHead; ///< Position of the next pop.
+
+  public:
+    CBoundedQueue(size_t n=RESULT_QUEUE_SIZE); ///< Constructor.
+    ~CBoundedQueue(); ///< Destructor.
+
+    bool try_push(const data& element); ///< Insert at tail if not full.
+    void push(const data& element); ///< Insert at tail.
+    bool pop(data& element); ///< Delete from head and return.
+    size_t size(); ///< Get queue size.
+}; //CBoundedQueue
+
+#endif
@@ -0,0 +1,57 @@
+/// \file CancelToken.cpp
+/// \brief Code for the cancellation token CCancelToken.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "CancelToken.h"
+
+/// Construct a cancellation token.
+/// \param pFlag Pointer to a flag that is set to cancel, if any.
+/// \param ms Time limit in milliseconds, or 0 for none.
+
+CCancelToken::CCancelToken(const std::atomic_bool* pFlag, UINT ms):
+  m_pFlag(pFlag), m_nTimeLimit(ms){
+} //constructor
+
+/// Start the clock, that is, set the deadline to the time limit from now.
+
+void CCancelToken::Start(){
+  m_tDeadline = std::chrono::steady_clock::now() + 
+    std::chrono::milliseconds(m_nTimeLimit);
+} //Start
+
+/// Determine whether the search should give up, that is, whether the shared
+/// flag has been set or the time limit has run out.
+/// \return true If the search has been cancelled.
+
+bool CCancelToken::IsCancelled() const{
+  return (m_pFlag != nullptr && *m_pFlag) || HasTimedOut();
+} //IsCancelled
+
+/// Determine whether the time limit, if there is one, has run out since
+/// Start() was called.
+/// \return true If the time limit has run out.
+
+bool CCancelToken::HasTimedOut() const{
+  return m_nTimeLimit > 0 && std::chrono::steady_clock::now() >= m_tDeadline;
+} //HasTimedOut
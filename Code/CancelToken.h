@@ -0,0 +1,58 @@
+/// \file CancelToken.h
+/// \brief Header for the cancellation token CCancelToken.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __CancelToken__
+#define __CancelToken__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Cancellation token.
+///
+/// Tells a search whether it should give up. A search is cancelled when a
+/// flag shared by all of the searches in a job is set, for example because
+/// another search has already finished the job, or when its own time limit
+/// runs out. The clock starts when Start() is called, so a request that
+/// waits in a queue doesn't use up its time limit. After Start() the token
+/// is only read, so it can be checked from any number of threads. Each
+/// check reads the clock, so the generators check every so often in their
+/// inner loops rather than every time around them.
+
+class CCancelToken{
+  private:
+    const std::atomic_bool* m_pFlag = nullptr; ///< Shared flag, if any.
+    UINT m_nTimeLimit = 0; ///< Time limit in milliseconds, or 0 for none.
+    std::chrono::steady_clock::time_point m_tDeadline; ///< Time to give up.
+
+  public:
+    CCancelToken(const std::atomic_bool* pFlag=nullptr, 
+      UINT ms=0); ///< Constructor.
+
+    void Start(); ///< Start the clock.
+    bool IsCancelled() const; ///< Whether to give up.
+    bool HasTimedOut() const; ///< Whether the time limit has run out.
+}; //CCancelToken
+
+#endif
@@ -25,79 +25,95 @@
 
 #include "ConcentricBraid.h"
 
-/// Create boards for the \f$4 \times 4\f$ and \f$6 \times 6\f$
-/// centers of concentric tourneys.
+constexpr int CConcentricBraid::m_nMove4x4[16]; ///< 4x4 center.
+constexpr int CConcentricBraid::m_nMove6x6[36]; ///< 6x6 center.
 
+/// Get the board for the \f$4 \times 4\f$ or \f$6 \times 6\f$
+/// center of concentric tourneys. The boards are local statics, so they
+/// are created once, in a thread-safe manner, the first time they are used.
+///
 /// \image html BraidedConcentricCenters.png
+///
+/// \param m Width of center, either 4 or 6.
+/// \return Reference to the center.
 
-CConcentricBraid::CConcentricBraid(){ 
-  m_pBoard4x4 = new CBoard(m_nMove4x4, 4, 4);
-  m_pBoard6x6 = new CBoard(m_nMove6x6, 6, 6);
-} //constructor
+const CBoard& CConcentricBraid::GetCenter(int m){
+  static const CBoard board4x4(m_nMove4x4, 4, 4); //4x4 center
+  static const CBoard board6x6(m_nMove6x6, 6, 6); //6x6 center
 
-/// Delete the boards for the \f$4 \times 4\f$ and \f$6 \times 6\f$
-/// centers of concentric tourneys created in the constructor.
+  return (m == 4)? board4x4: board6x6;
+} //GetCenter
 
-CConcentricBraid::~CConcentricBraid(){ 
-  delete m_pBoard4x4;
-  delete m_pBoard6x6;
-} //destructor
-
-/// Generate a concentric tourney.
+/// Generate a concentric tourney. The cancellation token, if any, is checked
+/// once per ring, and a cancelled board is left incomplete.
 /// \param b [in, out] Chessboard.
+/// \param pCancel Pointer to cancellation token, nullptr for none.
 
-void CConcentricBraid::Generate(CBoard& b){
+template<class T> void CConcentricBraid::Generate(CBoardT<T>& b,
+  const CCancelToken* pCancel)
+{
   const int w = b.GetWidth(); //board width
   const int h = b.GetHeight(); //board height
   if((w & 1) || w != h)return; //board must be square with even width
+
+  const T n = w; //board width as a cell index, to avoid overflow
   
   const UINT limit = (w%4 == 2)? w/2 - 3: w/2 - 2;
 
-  for(UINT offset=0; offset<limit; offset+=2)
+  for(UINT offset=0; offset<limit; offset+=2){
+    if(pCancel && pCancel->IsCancelled())
+      return; //abandon the board
+
     for(UINT k=0; k<4; k++){ 
       UINT i = offset;
       UINT j = offset + k;
 
       while(j < w - offset - 2){
-        UINT cur = i*w + j;
+        const T cur = i*n + j;
         i = (i == offset)? offset + 1: offset; 
         j += 2;
-        b.InsertUndirectedMove(cur, i*w + j);
+        b.InsertUndirectedMove(cur, i*n + j);
       } //while
 
       while(i < w - offset - 2){
-        UINT cur = i*w + j;
+        const T cur = i*n + j;
         i += 2;
         j = (j == w - offset - 1)? w - offset - 2: w - offset - 1; 
-        b.InsertUndirectedMove(cur, i*w + j);
+        b.InsertUndirectedMove(cur, i*n + j);
       } //while
 
       while(j >= offset + 2){
-        UINT cur = i*w + j;
+        const T cur = i*n + j;
         i = (i == w - offset - 1)? w - offset - 2: w - offset - 1; 
         j -= 2;
-        b.InsertUndirectedMove(cur, i*w + j);
+        b.InsertUndirectedMove(cur, i*n + j);
       } //while
 
       while(i >= offset + 2){
-        UINT cur = i*w + j;
+        const T cur = i*n + j;
         i -= 2;
         j = (j == offset)? offset + 1: offset; 
-        b.InsertUndirectedMove(cur, i*w + j);
+        b.InsertUndirectedMove(cur, i*n + j);
       } //while
 
       if(i != offset)
-        b.InsertUndirectedMove(i*w + j, (i - 1)*w + j + 2);
+        b.InsertUndirectedMove(i*n + j, (i - 1)*n + j + 2);
     } //for
+  } //for
 
   //generate center, either 4x4 or 6x6
 
   const int m = 4 + w%4; //width of center, either 4 or 6
   const int offset = (w - m)/2; //offset from top and left
 
-  if(m == 4)
-    b.CopyToSubBoard(*m_pBoard4x4, offset, offset);
-
-  else if(m == 6)
-    b.CopyToSubBoard(*m_pBoard6x6, offset, offset);
+  b.CopyToSubBoard(GetCenter(m), offset, offset);
 } //GenerateConcentric
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template void CConcentricBraid::Generate(CBoard& b,
+  const CCancelToken* pCancel); ///< 32-bit.
+template void CConcentricBraid::Generate(CLargeBoard& b,
+  const CCancelToken* pCancel); ///< 64-bit.
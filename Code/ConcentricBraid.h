@@ -38,10 +38,13 @@
 /// and \f$18 \times 18\f$ concentric braided tourneys.
 ///
 /// \image html BraidedConcentric.png
+///
+/// The centers are read-only boards shared by the whole process, created
+/// the first time that they are needed.
 
 class CConcentricBraid{
   private:
-    int m_nMove4x4[16] = ///< Undirected move table for 4x4 center.\image html bc4x4.png
+    static constexpr int m_nMove4x4[16] = ///< Undirected move table for 4x4 center.\image html bc4x4.png
       {
         6,  7,  4,  5, 
         13, 12, 15, 14, 
@@ -49,7 +52,7 @@ class CConcentricBraid{
         10, 11,  8,  9
       }; //m_nMove4x4
 
-    int m_nMove6x6[36] =  
+    static constexpr int m_nMove6x6[36] =  
       {
         8, 12,  6,  7, 17,  9, 
         19, 18,  4,  1,  2,  3, 
@@ -59,14 +62,11 @@ class CConcentricBraid{
         26, 20, 24, 29, 23, 27
       }; ///< Undirected move table for 6x6 center. \image html bc6x6.png
 
-    CBoard* m_pBoard4x4 = nullptr; ///< Pointer to 4x4 center.
-    CBoard* m_pBoard6x6 = nullptr; ///< Pointer to 6x6 center.
+    static const CBoard& GetCenter(int m); ///< Get center of width m.
 
   public:
-    CConcentricBraid(); ///< Constructor.
-    ~CConcentricBraid(); ///< Destructor.
-
-    void Generate(CBoard& b); ///< Generate a concentric braided tourney.
+    template<class T> 
+      void Generate(CBoardT<T>& b, const CCancelToken* pCancel=nullptr); ///< Generate a concentric braided tourney.
 }; //CConcentricBraid
 
 #endif
\ No newline at end of file
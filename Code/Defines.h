@@ -29,6 +29,15 @@
 #include "Includes.h"
 
 #define UNUSED -1 ///< Contents of unused square on the chessboard.
+#define BLOCKED -2 ///< Contents of sentinel square outside the chessboard.
+#define PADDING 2 ///< Width of sentinel border around a padded chessboard.
+
+#define SHATTER_ROUNDS 16 ///< Default number of shatters when obfuscating.
+#define ADAPTIVE 0 ///< Number of shatters meaning shatter until mixed.
+#define STREAM_SHATTER_ROUNDS 2 ///< Shatters between consecutive streamed tours.
+#define STREAM_MAX_FAILURES 8 ///< Consecutive failed joins before a stream gives up.
+#define RESULT_QUEUE_SIZE 1024 ///< Capacity of the search result queue.
+#define CANCEL_POLL_INTERVAL 1024 ///< Inner loop iterations per cancellation check, a power of 2.
 
 #define sqr(x) ((x)*(x)) ///< Squaring function.
 
@@ -36,6 +45,8 @@
 
 #if !defined(_MSC_VER) //*nix 
   typedef uint64_t UINT64; ///< Typedef of UINT64 for *NIX.
+  typedef int64_t INT64; ///< Typedef of INT64 for *NIX.
+  typedef uint8_t BYTE; ///< Typedef of BYTE for *NIX.
 #endif
 
 /////////////////////////////////////////////////////////////////////////
@@ -45,8 +56,8 @@
 /// Tourney generation algorithm.
 
 enum class GeneratorType{
-  Unknown, Warnsdorff, TakefujiLee, DivideAndConquer, ConcentricBraid,
-  FourCover
+  Unknown, Warnsdorff, TakefujiLee, TakefujiLeeSync, DivideAndConquer,
+  ConcentricBraid, FourCover
 }; //GeneratorType
 
 /////////////////////////////////////////////////////////////////////////
@@ -66,7 +77,7 @@ enum class CycleType{
 /// Type of task that this program can perform.
 
 enum class Task{
-  Unknown, Generate, Measure, Time
+  Unknown, Generate, Measure, Time, Stream, Benchmark
 }; //Task
 
 /////////////////////////////////////////////////////////////////////////
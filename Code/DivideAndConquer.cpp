@@ -25,40 +25,132 @@
 
 #include "DivideAndConquer.h"
 
+std::map<std::pair<int, int>, std::shared_ptr<CDivideAndConquerPlan>> 
+  CDivideAndConquer::m_mapPlans; ///< Plan cache.
+std::deque<std::pair<int, int>> 
+  CDivideAndConquer::m_stdCacheOrder; ///< Cached sizes, oldest first.
+std::mutex CDivideAndConquer::m_mutexPlans; ///< Mutex for the plan cache.
+
+/// The tile placement constructor.
+/// \param tile Tile identifier.
+/// \param x Column of left of tile.
+/// \param y Row of top of tile.
+
+CTilePlacement::CTilePlacement(int tile, int x, int y):
+  m_nTile(tile), m_nX(x), m_nY(y){
+} //constructor
+
 /// Default constructor.
 
-CDivideAndConquer::CDivideAndConquer(): CTile(){ 
+CDivideAndConquer::CDivideAndConquer(){ 
 } //constructor
 
-/// Generate a knight's tour or tourney. 
+/// Generate a knight's tour or tourney by replaying the plan for a board of
+/// this size. The tile placements are divided as evenly as possible among the
+/// threads in the thread pool, if there is one, each of which gets at least
+/// the grain size in cells. The joins
+/// are made after all of the tiles have been placed. The cancellation token,
+/// if any, is checked periodically during tile placement, and a cancelled
+/// board is left incomplete.
 /// \param b [in, out] Board.
 /// \param t Tourney descriptor.
+/// \param pPool Pointer to a thread pool to place tiles with, if any.
+/// \param pCancel Pointer to cancellation token, nullptr for none.
 
-void CDivideAndConquer::Generate(CBoard& b, CycleType t){
+template<class T> void CDivideAndConquer::Generate(CBoardT<T>& b, 
+  CycleType t, CThreadPool* pPool, const CCancelToken* pCancel)
+{
   b.MakeDirected(); //the generation algorithm requires a directed board
-  Generate(b, t, CRect(0, b.GetWidth(), 0, b.GetHeight())); //the whole board
+
+  const std::shared_ptr<CDivideAndConquerPlan> pPlan = 
+    GetPlan(b.GetWidth(), b.GetHeight()); //plan for this board size
+  const CDivideAndConquerPlan& plan = *pPlan; //shorthand
+  const size_t n = plan.m_vecTiles.size(); //number of tile placements
+
+  const T cells = b.GetSize(); //number of cells
+  const T nThreads = (pPool == nullptr)? 1: pPool->GetNumThreads(); //threads
+  const int k = (int)std::max((T)1, //number of chunks
+    std::min(nThreads, cells/m_nGrainSize));
+
+  if(k == 1)PlaceTiles(b, plan, 0, n, pCancel); //place them in this thread
+  else pPool->Run(k, [&](int i){ //place chunks of tiles in the thread pool
+    PlaceTiles(b, plan, i*n/k, (i + 1)*n/k, pCancel);
+  }); //Run
+
+  const bool bCancelled = pCancel && pCancel->IsCancelled(); //tiles incomplete
+
+  if(t == CycleType::Tour && !bCancelled) //join the tiles
+    for(auto& p: plan.m_vecJoins)
+      Join(b, p.first, p.second);
+
   b.MakeUndirected(); //return an undirected board
 } //Generate
 
-/// Generate a tour or tourney in a sub-board using divide-and-conquer.
-/// Requires that the board is directed, otherwise this function does nothing.
-/// This is a recursive function, but the depth of recursion is only
+/// Get the plan for a board of a given size from the plan cache, or compile
+/// it if it isn't there. A newly compiled plan is added to the cache unless
+/// it has more than m_nMaxCachedTiles tile placements, and if that makes
+/// the cache hold more than m_nMaxCachedPlans plans, then the oldest one is
+/// evicted. The plan is shared with the cache, so it stays valid for as long
+/// as the caller holds on to it even if it is evicted in the meantime. Plans
+/// are compiled with the mutex unlocked so that other threads aren't kept
+/// waiting, which means that two threads may occasionally compile the same
+/// plan.
+/// \param w Board width.
+/// \param h Board height.
+/// \return Pointer to the plan.
+
+std::shared_ptr<CDivideAndConquerPlan> CDivideAndConquer::GetPlan(int w, int h){
+  const std::pair<int, int> key = std::make_pair(w, h); //cache key
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutexPlans);
+    auto it = m_mapPlans.find(key); //look in the cache
+    if(it != m_mapPlans.end())return it->second; //found it
+  }
+
+  //not there, so compile it
+
+  std::shared_ptr<CDivideAndConquerPlan> pPlan = 
+    std::make_shared<CDivideAndConquerPlan>(); //new plan
+  CompilePlan(*pPlan, CRect(0, w, 0, h)); 
+
+  if(pPlan->m_vecTiles.size() <= (size_t)m_nMaxCachedTiles){ //small enough to cache
+    std::lock_guard<std::mutex> lock(m_mutexPlans);
+
+    if(m_mapPlans.insert(std::make_pair(key, pPlan)).second){ //new entry
+      m_stdCacheOrder.push_back(key);
+
+      if((int)m_stdCacheOrder.size() > m_nMaxCachedPlans){ //evict oldest
+        m_mapPlans.erase(m_stdCacheOrder.front());
+        m_stdCacheOrder.pop_front();
+      } //if
+    } //if
+  } //if
+
+  return pPlan;
+} //GetPlan
+
+/// Compile the plan for a sub-board using divide-and-conquer. This is a
+/// recursive function, but the depth of recursion is only
 /// \f$\log_2 n + O(1)\f$ and the total work done is \f$O(n^2)\f$ for an
 /// \f$n \times n\f$ board (that is, time linear in the size of the board).
-/// \param b [in, out] Board.
-/// \param t Tourney descriptor. 
+/// \param plan [in, out] Plan to be appended to.
 /// \param rect Rectangle defining sub-board.
 
-void CDivideAndConquer::Generate(CBoard& b, CycleType t, const CRect& rect){
-  if(b.IsUndirected())return; //enforce requirement that the board is directed
-
+void CDivideAndConquer::CompilePlan(CDivideAndConquerPlan& plan, 
+  const CRect& rect)
+{
   const int w = rect.m_nRight - rect.m_nLeft;
   const int h = rect.m_nBottom - rect.m_nTop;
 
-  if(w < 12 || h < 12) //base of recursion
-    GenerateBaseCase(b, rect);
+  if(w < 12 || h < 12){ //base of recursion
+    const int id = CTile::GetTileId(w, h); //identifier of tile that fits
+
+    if(id != UNUSED)
+      plan.m_vecTiles.push_back(CTilePlacement(id, rect.m_nLeft, rect.m_nTop));
+  } //if
 
-  else{ //split into four quadrants and generate a knight's tour in each
+  else{ //split into four quadrants and compile a plan for each
     const int midx = Split(rect.m_nLeft, rect.m_nRight);
     const int midy = Split(rect.m_nTop, rect.m_nBottom);
 
@@ -67,15 +159,14 @@ void CDivideAndConquer::Generate(CBoard& b, CycleType t, const CRect& rect){
     const CRect r2(rect.m_nLeft, midx, midy, rect.m_nBottom); //quadrant 2
     const CRect r3(midx, rect.m_nRight, midy, rect.m_nBottom); //quadrant 3
     
-    Generate(b, t, r0); //recurse on quadrant 0
-    Generate(b, t, r1); //recurse on quadrant 1
-    Generate(b, t, r2); //recurse on quadrant 2
-    Generate(b, t, r3); //recurse on quadrant 3
+    CompilePlan(plan, r0); //recurse on quadrant 0
+    CompilePlan(plan, r1); //recurse on quadrant 1
+    CompilePlan(plan, r2); //recurse on quadrant 2
+    CompilePlan(plan, r3); //recurse on quadrant 3
 
-    if(t == CycleType::Tour) //join the quadrants
-      Join(b, midx, midy);
+    plan.m_vecJoins.push_back(std::make_pair(midx, midy)); //join the quadrants
   } //else
-} //Generate
+} //CompilePlan
 
 /// Splits a pair of coordinates nearly in half such that both parts
 /// have even parity.
@@ -104,24 +195,24 @@ int CDivideAndConquer::Split(int left, int right){
 /// \param midx Split x-coordinate.
 /// \param midy Split y-coordinate.
 
-void CDivideAndConquer::Join(CBoard& b, int midx, int midy){
+template<class T> void CDivideAndConquer::Join(CBoardT<T>& b, int midx, int midy){
   if(b.IsUndirected())return; //enforce requirement that the board is directed
 
-  const int w = b.GetWidth();
+  const T w = b.GetWidth();
 
   //delete moves A, B, C, D (see the figure in the Doxygen-generated docs).
 
-  const int A_left = (midy - 1)*w + midx - 3; 
-  const int A_right = (midy - 2)*w + midx - 1;
+  const T A_left = (midy - 1)*w + midx - 3; 
+  const T A_right = (midy - 2)*w + midx - 1;
 
-  const int B_left = (midy - 1)*w + midx; 
-  const int B_right = (midy - 3)*w + midx + 1;
+  const T B_left = (midy - 1)*w + midx; 
+  const T B_right = (midy - 3)*w + midx + 1;
 
-  const int C_left = (midy + 1)*w + midx; 
-  const int C_right = midy*w + midx + 2; 
+  const T C_left = (midy + 1)*w + midx; 
+  const T C_right = midy*w + midx + 2; 
 
-  const int D_left = (midy + 2)*w + midx - 2; 
-  const int D_right = midy*w + midx - 1;
+  const T D_left = (midy + 2)*w + midx - 2; 
+  const T D_right = midy*w + midx - 1;
 
   b.DeleteMove(A_left, A_right);
   b.DeleteMove(B_left, B_right);
@@ -136,43 +227,32 @@ void CDivideAndConquer::Join(CBoard& b, int midx, int midy){
   b.InsertDirectedMove(D_right, A_left);
 } //Join
 
-/// Copy one of the base tiles in the base class CTile to a sub-board.
+/// Place a range of the tiles in a plan. Requires that the board is directed.
 /// \param b [in, out] Board.
-/// \param rect Rectangle in which to place tile.
-
-void CDivideAndConquer::GenerateBaseCase(CBoard& b, const CRect& rect){
-  const int w = rect.m_nRight - rect.m_nLeft; //width of tile
-  const int h = rect.m_nBottom - rect.m_nTop; //height of tile
-
-  const int x = rect.m_nLeft; //column of cell for left of tile
-  const int y = rect.m_nTop; //row of cell for top of tile
-
-  //copy the correct tile on a case-by-case basis
-
-  if(w == 6 && h == 6)
-    b.CopyToSubBoard(*m_pTile6x6, x, y);
-
-  else if(w == 8 && h == 6)
-    b.CopyToSubBoard(*m_pTile8x6, x, y);
-
-  else if(w == 6 && h == 8)
-    b.CopyToSubBoard(*m_pTile6x8, x, y);
-
-  else if(w == 8 && h == 8)
-    b.CopyToSubBoard(*m_pTile8x8, x, y);
-
-  else if(w == 10 && h == 8)
-    b.CopyToSubBoard(*m_pTile10x8, x, y);
-
-  else if(w == 8 && h == 10)
-    b.CopyToSubBoard(*m_pTile8x10, x, y);
-
-  else if(w == 10 && h == 10)
-    b.CopyToSubBoard(*m_pTile10x10, x, y);
-
-  else if(w == 12 && h == 10)
-    b.CopyToSubBoard(*m_pTile12x10, x, y);
-
-  else if(w == 10 && h == 12)
-    b.CopyToSubBoard(*m_pTile10x12, x, y);
-} //GenerateBaseCase
\ No newline at end of file
+/// \param plan Divide-and-conquer plan.
+/// \param first Index of the first tile placement to make.
+/// \param last One more than the index of the last tile placement to make.
+/// \param pCancel Pointer to cancellation token, nullptr for none.
+
+template<class T> void CDivideAndConquer::PlaceTiles(CBoardT<T>& b, 
+  const CDivideAndConquerPlan& plan, size_t first, size_t last,
+  const CCancelToken* pCancel)
+{
+  for(size_t i=first; i<last; i++){
+    if(pCancel && (i - first)%CANCEL_POLL_INTERVAL == 0 && 
+      pCancel->IsCancelled())
+        return; //abandon the remaining tiles
+
+    const CTilePlacement& p = plan.m_vecTiles[i]; //shorthand
+    b.CopyToSubBoard(CTile::GetTile(p.m_nTile), p.m_nX, p.m_nY);
+  } //for
+} //PlaceTiles
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template void CDivideAndConquer::Generate(CBoard& b, CycleType t, 
+  CThreadPool* pPool, const CCancelToken* pCancel); ///< 32-bit.
+template void CDivideAndConquer::Generate(CLargeBoard& b, CycleType t,
+  CThreadPool* pPool, const CCancelToken* pCancel); ///< 64-bit.
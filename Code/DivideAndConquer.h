@@ -31,6 +31,35 @@
 #include "Tile.h"
 #include "Structs.h"
 
+/// \brief Tile placement.
+///
+/// A tile placement consists of a tile identifier and the coordinates of the
+/// cell at which the top left corner of the tile is to be placed.
+
+struct CTilePlacement{
+  int m_nTile = UNUSED; ///< Tile identifier.
+  int m_nX = 0; ///< Column of left of tile.
+  int m_nY = 0; ///< Row of top of tile.
+
+  CTilePlacement(int tile, int x, int y); ///< Constructor.
+}; //CTilePlacement
+
+/////////////////////////////////////////////////////////////////////////
+
+/// \brief Divide-and-conquer plan.
+///
+/// The tile placements made by the divide-and-conquer algorithm on a board of
+/// a given size, in the order in which the recursion makes them, and the split
+/// coordinates of the joins that it makes, in post-order (that is, each join
+/// comes after the joins of its quadrants).
+
+struct CDivideAndConquerPlan{
+  std::vector<CTilePlacement> m_vecTiles; ///< Tile placements.
+  std::vector<std::pair<int, int>> m_vecJoins; ///< Split coordinates of joins.
+}; //CDivideAndConquerPlan
+
+/////////////////////////////////////////////////////////////////////////
+
 /// \brief Divide-and-conquer knight's tour and tourney generator.
 ///
 /// This divide-and-conquer algorithm used in this class was invented by me,
@@ -44,18 +73,51 @@
 /// carefully chosen moves and inserting four to replace them.  
 ///
 /// \image html Tiled.png
+///
+/// The generator works on boards with either 32-bit or 64-bit cell indices.
+/// The tiles are always 32-bit boards.
+///
+/// The tile placements and joins depend only on the width and height of the
+/// board, so the recursion is run once per board size to compile a plan.
+/// Plans for the last few board sizes are cached, unless they are too large
+/// to be worth keeping, in which case the plan is compiled afresh each time.
+/// Generation replays the plan. Since the tiles occupy
+/// disjoint cells, the placements are divided among the available threads.
+/// The joins are then made in order by the calling thread.
 
-class CDivideAndConquer: public CTile{
+class CDivideAndConquer{
   private:
-    int Split(int left, int right); ///< Split coordinates nearly in half.
-    void Join(CBoard& b, int midx, int midy); ///< Join 4 sub-boards.
-    void Generate(CBoard& b, CycleType t, const CRect& rect); ///< Recursion.
-    void GenerateBaseCase(CBoard& b, const CRect& rect); ///< Base of recursion.
+    static const int m_nGrainSize = 1 << 16; ///< Smallest area for a thread.
+    static const int m_nMaxCachedPlans = 8; ///< Most plans in the cache.
+    static const int m_nMaxCachedTiles = 1 << 16; ///< Most tiles in a cached plan.
+
+    static std::map<std::pair<int, int>, 
+      std::shared_ptr<CDivideAndConquerPlan>> 
+      m_mapPlans; ///< Plan cache, indexed by width and height.
+    static std::deque<std::pair<int, int>> 
+      m_stdCacheOrder; ///< Cached sizes, oldest first.
+    static std::mutex m_mutexPlans; ///< Mutex for the plan cache.
+
+    static int Split(int left, int right); ///< Split coordinates nearly in half.
+
+    static void CompilePlan(CDivideAndConquerPlan& plan, 
+      const CRect& rect); ///< Recursion.
+    static std::shared_ptr<CDivideAndConquerPlan> 
+      GetPlan(int w, int h); ///< Get plan.
+
+    template<class T> 
+      void Join(CBoardT<T>& b, int midx, int midy); ///< Join 4 sub-boards.
+
+    template<class T> void PlaceTiles(CBoardT<T>& b, 
+      const CDivideAndConquerPlan& plan, size_t first, size_t last,
+      const CCancelToken* pCancel); ///< Tiles.
 
   public:
     CDivideAndConquer(); ///< Constructor.
 
-    void Generate(CBoard& b, CycleType t); ///< Generate a tour or tourney.
+    template<class T> void Generate(CBoardT<T>& b, CycleType t,
+      CThreadPool* pPool=nullptr, 
+      const CCancelToken* pCancel=nullptr); ///< Generate tour or tourney.
 }; //CDivideAndConquer
 
 #endif
\ No newline at end of file
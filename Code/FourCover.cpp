@@ -31,7 +31,7 @@
 /// \param b [in, out] Chessboard.
 /// \param v Array of four vertices.
 
-void CFourCover::Generate4Cycle(CBoard& b, int v[4]){
+template<class T> void CFourCover::Generate4Cycle(CBoardT<T>& b, T v[4]){
   b.InsertUndirectedMove(v[0], v[1]);
   b.InsertUndirectedMove(v[1], v[2]);
   b.InsertUndirectedMove(v[2], v[3]);
@@ -39,18 +39,23 @@ void CFourCover::Generate4Cycle(CBoard& b, int v[4]){
 } //Generate4Cycle
 
 /// Generate a four-cover tourney. Assumes that the board has both width and
-/// height divisible by 4. Does nothing otherwise.
+/// height divisible by 4. Does nothing otherwise. The cancellation token, if
+/// any, is checked once per row of blocks, and a cancelled board is left
+/// incomplete.
 /// \param b [in, out] Chessboard.
+/// \param pCancel Pointer to cancellation token, nullptr for none.
 
-void CFourCover::Generate(CBoard& b){
-  const int w = b.GetWidth(); //board width
-  const int h = b.GetHeight(); //board height
+template<class T> void CFourCover::Generate(CBoardT<T>& b,
+  const CCancelToken* pCancel)
+{
+  const T w = b.GetWidth(); //board width
+  const T h = b.GetHeight(); //board height
 
   if(w%4 != 0 || h%4 != 0)return; //width and height must be divisible by 4
 
-  for(int i=0; i<h; i+=4)
-    for(int j=0; j<w; j+=4){
-      int v[4]; //four vertices in the cycle
+  for(T i=0; i<h && !(pCancel && pCancel->IsCancelled()); i+=4)
+    for(T j=0; j<w; j+=4){
+      T v[4]; //four vertices in the cycle
 
       v[0] = i*w + j;
       v[1] = v[0] + w + 2;
@@ -81,3 +86,12 @@ void CFourCover::Generate(CBoard& b){
       Generate4Cycle(b, v); //fourth edge 
     } //for
 } //Generate
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template void CFourCover::Generate(CBoard& b,
+  const CCancelToken* pCancel); ///< 32-bit.
+template void CFourCover::Generate(CLargeBoard& b,
+  const CCancelToken* pCancel); ///< 64-bit.
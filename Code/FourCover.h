@@ -37,10 +37,12 @@
 
 class CFourCover{
   private:
-    void Generate4Cycle(CBoard& b, int v[4]); ///< Generate a 4-cycle.
+    template<class T> 
+      void Generate4Cycle(CBoardT<T>& b, T v[4]); ///< Generate a 4-cycle.
 
   public:
-    void Generate(CBoard& b); ///< Generate a four-cover tourney.
+    template<class T> 
+      void Generate(CBoardT<T>& b, const CCancelToken* pCancel=nullptr); ///< Generate a four-cover tourney.
 }; //CFourCover
 
 #endif
\ No newline at end of file
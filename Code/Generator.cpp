@@ -27,6 +27,7 @@
 #include "Random.h"
 #include "Defines.h"
 #include "Timer.h"
+#include "ThreadPool.h"
 #include "Board.h"
 #include "DivideAndConquer.h"
 #include "ConcentricBraid.h"
@@ -42,7 +43,7 @@ CGenerator::CGenerator(){
 /// \param h Board width.
 
 CGenerator::CGenerator(int w, int h):
-  m_nWidth(w), m_nHeight(h), m_nSize(w*h){ 
+  m_nWidth(w), m_nHeight(h), m_nSize((INT64)w*h){ 
 } //constructor
 
 /// Create an empty square chessboard.
@@ -56,23 +57,22 @@ CGenerator::CGenerator(int n): CGenerator(n, n){
 
 #pragma region Task::Generate
 
-/// Generate a single knight's tour or tourney.
-/// Fill the request queue, launch the search threads, then
-/// wait for them to terminate and output the resulting
-/// tour or tourney to a file.
+/// Generate a single knight's tour or tourney using one of the deterministic
+/// generators and output it to a file. The cell index type is a template
+/// parameter so that boards with more than \f$2^{31}\f$ cells can be used.
 /// \param t Tourney descriptor.
-/// \param nThreads Number of search threads to use.
+/// \param pool Thread pool for generating, joining, and obfuscating.
 
-void CGenerator::Generate(const CTourneyDesc& t, int nThreads){ 
+template<class T> 
+void CGenerator::GenerateDeterministic(const CTourneyDesc& t, CThreadPool& pool){ 
   const GeneratorType gentype = t.m_eGenerator;
   const CycleType cycletype = t.m_eCycle;
 
-   //deterministic generators 
-
   if(gentype == GeneratorType::DivideAndConquer){ 
-    CBoard b(m_nWidth, m_nHeight); //board for the tour
-    CDivideAndConquer().Generate(b, cycletype); //generate it
-    if(t.m_bObfuscate)b.Obfuscate(); //obfuscate if necessary
+    CBoardT<T> b(m_nWidth, m_nHeight); //board for the tour
+    CDivideAndConquer().Generate(b, cycletype, &pool); //generate it
+    if(t.m_bObfuscate) //obfuscate if necessary
+      b.Obfuscate(t.m_nShatterRounds, &pool);
 
     std::string s = MakeFileNameBase(t, b.GetWidth()); //file name
 
@@ -81,10 +81,12 @@ void CGenerator::Generate(const CTourneyDesc& t, int nThreads){
   } //if
 
   else if(gentype == GeneratorType::ConcentricBraid){ 
-    CBoard b(m_nWidth, m_nHeight); //board for the tour
+    CBoardT<T> b(m_nWidth, m_nHeight); //board for the tour
     CConcentricBraid().Generate(b); //generate it
-    if(cycletype == CycleType::TourFromTourney)b.JoinUntilTour(); //make tour
-    if(t.m_bObfuscate)b.Obfuscate(); //obfuscate if necessary
+    if(cycletype == CycleType::TourFromTourney) //make tour
+      b.JoinUntilTour(&pool);
+    if(t.m_bObfuscate) //obfuscate if necessary
+      b.Obfuscate(t.m_nShatterRounds, &pool);
 
     std::string s = MakeFileNameBase(t, b.GetWidth()); //save file name
     b.Save(s); //save to text file
@@ -92,24 +94,56 @@ void CGenerator::Generate(const CTourneyDesc& t, int nThreads){
   } //if
 
   else if(gentype == GeneratorType::FourCover){
-    CBoard b(m_nWidth, m_nHeight); //board for the tour
+    CBoardT<T> b(m_nWidth, m_nHeight); //board for the tour
     CFourCover().Generate(b); //generate it
-    if(cycletype == CycleType::TourFromTourney)b.JoinUntilTour(); //make tour
-    if(t.m_bObfuscate)b.Obfuscate(); //obfuscate if necessary
+    if(cycletype == CycleType::TourFromTourney) //make tour
+      b.JoinUntilTour(&pool);
+    if(t.m_bObfuscate) //obfuscate if necessary
+      b.Obfuscate(t.m_nShatterRounds, &pool);
 
     std::string s = MakeFileNameBase(t, b.GetWidth()); //save file name
     b.Save(s); //save to text file
     b.SaveToSVG(s); //save to SVG file
   } //if
+} //GenerateDeterministic
+
+/// Generate a single knight's tour or tourney. The deterministic generators
+/// use a board with 32-bit cell indices unless the board is too large for
+/// it, in which case they use 64-bit cell indices. For the probabilistic
+/// generators, fill the request queue, launch the search threads, then
+/// wait for them to terminate and output the resulting
+/// tour or tourney to a file. The asynchronous neural network generator
+/// instead makes a single search that shares each update among all of the
+/// threads in the pool.
+/// \param t Tourney descriptor.
+/// \param pool Thread pool for the search threads.
+
+void CGenerator::Generate(const CTourneyDesc& t, CThreadPool& pool){ 
+  const GeneratorType gentype = t.m_eGenerator;
+
+   //deterministic generators 
+
+  if(gentype == GeneratorType::DivideAndConquer ||
+    gentype == GeneratorType::ConcentricBraid ||
+    gentype == GeneratorType::FourCover){
+    if(m_nSize > INT_MAX) //too large for 32-bit cell indices
+      GenerateDeterministic<INT64>(t, pool);
+    else GenerateDeterministic<int>(t, pool);
+  } //if
 
   //probabilistic generators
 
   else{ 
-    for(int i=0; i<nThreads; i++) //queue up search requests
-      m_cSearchRequest.push(CSearchRequest(t, m_nWidth, m_nHeight, ::rand()));  
-  
-    for(int i=0; i<nThreads; i++) //launch the search threads
-      m_vecThreadList.push_back(std::thread((CSearchThread())));
+    const int nThreads = pool.GetNumThreads(); //number of threads
+    const bool bShared = gentype == GeneratorType::TakefujiLee && 
+      nThreads > 1; //whether one search gets the whole pool
+    const int nSearches = bShared? 1: nThreads; //number of search threads
+
+    for(int i=0; i<nSearches; i++){ //queue up search requests
+      CSearchRequest request = MakeRequest(t);
+      if(bShared)request.m_pPool = &pool; //for parallel updates
+      m_cSearchRequest.push(request);  
+    } //for
 
     //start timing CPU and elapsed time
 
@@ -117,35 +151,121 @@ void CGenerator::Generate(const CTourneyDesc& t, int nThreads){
     Timer.Start();
     printf("Starting %d theads at: %s", nThreads, Timer.GetCurrentDateAndTime());
 
-    //wait for all search threads to terminate
-  
-    std::for_each(m_vecThreadList.begin(), m_vecThreadList.end(), 
-      std::mem_fn(&std::thread::join));
-
+    RunSearchThreads(pool, nSearches); //run the search threads until done
     Timer.Finish(); //stop the timer
-    m_vecThreadList.clear(); //clear the thread list for next use
 
     //process results of search
 
-    CSearchResult result; //current search result
-
-    const int nResults = (int)m_cSearchResult.size();
-
-    if(nResults == 0)
+    if(m_pBoard == nullptr)
       printf("\n**** Error: Search failed, nothing to print.\n");
 
-    if(m_cSearchResult.pop(result)){ //get current search result
-      CBoard& b = *(result.m_pBoard);
-      std::string s = MakeFileNameBase(result.m_cTourneyDesc, b.GetWidth());
+    else{
+      CBoard& b = *m_pBoard;
+      std::string s = MakeFileNameBase(t, b.GetWidth());
 
       b.Save(s); //save tour to text file
       b.SaveToSVG(s); //save to SVG file
 
-      delete result.m_pBoard;
-    } //if
+      delete m_pBoard;
+      m_pBoard = nullptr;
+    } //else
   } //else
 } //Generate
 
+/// Run search threads on the thread pool, each of which processes search
+/// requests until the request queue is empty, and wait for them to finish.
+/// Meanwhile this thread consumes their results from the result queue as
+/// they arrive, so that the queue never holds more than a few of them. If
+/// the search threads fill the queue they wait for this thread to catch up.
+/// The request queue is first given one deque per search thread that the
+/// pool will actually run, so that each deque is some thread's own.
+/// \param pool Thread pool.
+/// \param n Number of search threads.
+
+void CGenerator::RunSearchThreads(CThreadPool& pool, int n){
+  CThreadPool::CBatch batch; //batch of search threads for the pool
+
+  m_cSearchRequest.resize(std::min(n, pool.GetNumThreads())); //a deque each
+
+  pool.Start(batch, n, [this](int i){
+    CSearchThread search(*this, i); //search thread code for worker i
+    search();
+  });
+
+  CSearchResult r; //current search result
+  bool bBusy = true; //whether the search threads are still running
+
+  while(bBusy){
+    bBusy = pool.IsBusy(batch); //check before draining, so the last drain is complete
+    bool bIdle = true; //whether there were no results
+
+    while(m_cSearchResult.pop(r)){ //drain the result queue
+      ConsumeResult(r);
+      bIdle = false;
+    } //while
+
+    if(bBusy && bIdle) //nothing to do for a while
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+  } //while
+
+  pool.Wait(batch);
+
+  if(m_nTimedOut > 0)
+    printf("%d search requests ran out of time\n", (int)m_nTimedOut);
+} //RunSearchThreads
+
+/// Make a search request for a tourney on a board of this generator's size
+/// with a random seed. Its cancellation token is tied to this job's
+/// termination flag and given this generator's time limit.
+/// \param t Tourney descriptor.
+/// \return Search request.
+
+CSearchRequest CGenerator::MakeRequest(const CTourneyDesc& t){
+  CSearchRequest request(t, m_nWidth, m_nHeight, ::rand());
+  request.m_cCancel = CCancelToken(&m_bFinished, m_nTimeLimit);
+  return request;
+} //MakeRequest
+
+/// Set the time limit for each search request. A search that runs out of
+/// time is abandoned and its result discarded.
+/// \param ms Time limit in milliseconds, or 0 for none.
+
+void CGenerator::SetTimeLimit(UINT ms){
+  m_nTimeLimit = ms;
+} //SetTimeLimit
+
+/// Consume a search result. Keep the first board to be returned and delete
+/// any others, and fold the move counts into a running mean and sum of
+/// squared deviations for each move using Welford's method, so that the
+/// statistics take constant space however many results there are.
+/// \param r Search result.
+
+void CGenerator::ConsumeResult(CSearchResult& r){
+  if(r.m_pBoard != nullptr){ //result has a board
+    if(m_pBoard == nullptr)
+      m_pBoard = r.m_pBoard;
+    else delete r.m_pBoard;
+  } //if
+
+  const double k = (double)++m_nResults; //number of results so far
+  const double denom = (double)m_nSize; //denominator for proportions
+
+  for(int i=0; i<8; i++){
+    const double x = (double)r.m_nSingleMove[i]/denom; //single move proportion
+    const double d = x - m_fSingleMean[i]; //deviation from old mean
+    m_fSingleMean[i] += d/k;
+    m_fSingleM2[i] += d*(x - m_fSingleMean[i]);
+
+    const double y = (double)r.m_nRelativeMove[i]/denom; //relative move proportion
+    const double e = y - m_fRelativeMean[i]; //deviation from old mean
+    m_fRelativeMean[i] += e/k;
+    m_fRelativeM2[i] += e*(y - m_fRelativeMean[i]);
+  } //for
+
+  m_fAttempts += r.m_nAttempts;
+  m_fSweeps += r.m_nSweeps;
+} //ConsumeResult
+
 #pragma endregion generation task
 
 ///////////////////////////////////////////////////////////////////
@@ -159,14 +279,16 @@ void CGenerator::Generate(const CTourneyDesc& t, int nThreads){
 /// of the 8 single moves and 8 double moves possible and write
 /// the results to a text file.
 /// \param t Type of tour to generate.
-/// \param nThreads Number of search threads to use.
+/// \param pool Thread pool for the search threads.
 /// \param n Number of tours to generate.
 
-void CGenerator::Measure(const CTourneyDesc& t, int nThreads, int n){ 
+void CGenerator::Measure(const CTourneyDesc& t, CThreadPool& pool, int n){ 
+  const int nThreads = pool.GetNumThreads(); //number of search threads
+
   //queue up search requests
 
   for(int i=0; i<n; i++){
-    CSearchRequest request(t, m_nWidth, m_nHeight, ::rand());
+    CSearchRequest request = MakeRequest(t);
     request.m_bDiscard = true; //we're measuring stats, so throw them away
     m_cSearchRequest.push(request); //submit request
   } //for
@@ -178,101 +300,48 @@ void CGenerator::Measure(const CTourneyDesc& t, int nThreads, int n){
 
   printf("Starting %d theads at: %s", nThreads, Timer.GetCurrentDateAndTime());
 
-  //launch the search threads
-  
-  for(int i=0; i<nThreads; i++)
-    m_vecThreadList.push_back(std::thread((CSearchThread())));
-
-  //wait for all search threads to terminate
-  
-  std::for_each(m_vecThreadList.begin(), m_vecThreadList.end(), 
-    std::mem_fn(&std::thread::join));
-
+  RunSearchThreads(pool, nThreads); //run the search threads until done
   Timer.Finish();
-  m_vecThreadList.clear(); //clear the thread list for next use
-
-  //process the measurements that were made by the threads
-
-  //you can't iterate through std::queue, so transfer results to an std::vector
 
-  std::vector<CSearchResult> results; //result list
-
-  CSearchResult r; //current search result
-
-  while(m_cSearchResult.pop(r)) //get current search result
-    results.push_back(r);
+  WriteStats("Stats" + MakeFileNameBase(t, m_nWidth) //process measurements
+    + "-" + std::to_string(n) + ".txt");
+} //Measure
 
-  //now process the results
+/// Write the statistics gathered from the search results, that is, the
+/// mean and standard deviation of the proportion of each of the 8 single
+/// moves and 8 relative moves, to a text file.
+/// \param strFileName Output file name.
 
-  double fSingleMove[8] = {0}; //single move count
-  double fRelativeMove[8] = {0}; //relative move count
-  
-  double fSingleMean[8] = {0}; //single move observed mean
-  double fRelativeMean[8] = {0}; //relative move observed mean 
-    
+void CGenerator::WriteStats(const std::string& strFileName){
   double fSingleStdev[8] = {0}; //single move standard deviation
   double fRelativeStdev[8] = {0}; //relative move standard deviation
 
-  //////////////////////////////////////////////////////////////////////
-
-    for(CSearchResult r: results)
-    for(int i=0; i<8; i++){
-      fSingleMove[i] += (double)r.m_nSingleMove[i];
-      fRelativeMove[i] += (double)r.m_nRelativeMove[i];
-    } //for
-
-  for(int i=0; i<8; i++){
-    fSingleMove[i] /= (double)m_nSize;
-    fRelativeMove[i] /= (double)m_nSize;
-  } //for
-
-  //compute observed mean
-  
-  for(int i=0; i<8; i++){
-    fSingleMean[i] = fSingleMove[i]/(double)n;
-    fRelativeMean[i] = fRelativeMove[i]/(double)n;
-  } //for
-
-  //compute observed standard deviation
+  if(m_nResults > 1){
+    const double denom = (double)m_nResults - 1; //denominator for standard deviation
 
-  const double denom = (double)m_nSize; //denominator
-  
-  for(CSearchResult r: results){
     for(int i=0; i<8; i++){
-      fSingleStdev[i] += sqr((double)r.m_nSingleMove[i]/denom - fSingleMean[i]);
-      fRelativeStdev[i] += sqr((double)r.m_nRelativeMove[i]/denom - fRelativeMean[i]);
-    } //for
-  } //for
-  
-  if(n > 1){
-    const double denom = (double)n - 1; //denominator for standard deviation
-
-    for(int i=0; i<8; i++){
-      fSingleStdev[i] = sqrt(fSingleStdev[i]/denom);
-      fRelativeStdev[i] = sqrt(fRelativeStdev[i]/denom);
+      fSingleStdev[i] = sqrt(m_fSingleM2[i]/denom);
+      fRelativeStdev[i] = sqrt(m_fRelativeM2[i]/denom);
     } //for
   } //if
 
   //write mean and standard deviation to a file
-  
-  std::string strFileName = "Stats" + MakeFileNameBase(t, m_nWidth) //file name
-    + "-" + std::to_string(n) + ".txt";
 
   FILE* output = fopen(strFileName.c_str(), "wt"); //open file
 
   if(output != nullptr){ //success
     fprintf(output, "Single\n");
-    fprintf(output, "Mean\t");  OutputStat(output, fSingleMean);
+    fprintf(output, "Mean\t");  OutputStat(output, m_fSingleMean);
     fprintf(output, "Stdev\t"); OutputStat(output, fSingleStdev);
     fprintf(output, "\n");
     
     fprintf(output, "Relative\n");    
-    fprintf(output, "Mean\t");  OutputStat(output, fRelativeMean);    
+    fprintf(output, "Mean\t");  OutputStat(output, m_fRelativeMean);    
     fprintf(output, "Stdev\t"); OutputStat(output, fRelativeStdev);
 
     fclose(output); //close file
   } //if
-} //Measure
+} //WriteStats
 
 /// Output statistic from the generation multiple knight's tours
 /// or tourneys to a file.
@@ -299,14 +368,14 @@ void CGenerator::OutputStat(FILE* output, double a[8]){
 /// wait for them to terminate, then append the CPU and elapsed times to
 /// a text file.
 /// \param t Tourney descriptor.
-/// \param nThreads Number of search threads to use.
+/// \param pool Thread pool for the search threads.
 /// \param n Number of tours to generate.
 
-void CGenerator::Time(const CTourneyDesc& t, int nThreads, int n){
+void CGenerator::Time(const CTourneyDesc& t, CThreadPool& pool, int n){
   //queue up search requests
 
   for(int i=0; i<n; i++){
-    CSearchRequest request(t, m_nWidth, m_nHeight, ::rand());
+    CSearchRequest request = MakeRequest(t);
     request.m_bDiscard = true;
     m_cSearchRequest.push(request);
   } //for
@@ -316,17 +385,7 @@ void CGenerator::Time(const CTourneyDesc& t, int nThreads, int n){
   CTimer Timer;
   Timer.Start();
 
-  //launch the search threads
-  
-  for(int i=0; i<nThreads; i++)
-    m_vecThreadList.push_back(std::thread((CSearchThread())));
-
-  //wait for all search threads to terminate
-  
-  std::for_each(m_vecThreadList.begin(), m_vecThreadList.end(), 
-    std::mem_fn(&std::thread::join));
-  
-  m_vecThreadList.clear(); //clear the thread list for next use
+  RunSearchThreads(pool, pool.GetNumThreads()); //run the search threads
   
   //append cpu and elapsed time to a file
 
@@ -336,24 +395,162 @@ void CGenerator::Time(const CTourneyDesc& t, int nThreads, int n){
   FILE* output = fopen(strFileName.c_str(), "at");
 
   if(output != nullptr){
-    OutputTimes(output, Timer.GetCPUTime(), Timer.GetElapsedTime());
+    OutputTimes(output, Timer.GetCPUTime(), Timer.GetElapsedTime(), n);
+
+    if(t.m_eGenerator == GeneratorType::TakefujiLee ||
+      t.m_eGenerator == GeneratorType::TakefujiLeeSync)
+      OutputConvergence(output, n);
+
+    fprintf(output, "\n");
     fclose(output);
   } //if
 } //Time
 
 /// Append times (cpu time and elapsed time) from the generation of multiple
-/// knight's tours or tourneys to a text file. The file name contains the 
-/// tourney type.
+/// knight's tours or tourneys to a line of a text file, followed by the CPU
+/// time per cell of output in microseconds, which allows generators to be
+/// compared across board sizes. The file name contains the tourney type.
 /// \param output Pointer to file.
 /// \param fCpu CPU time in seconds.
 /// \param fElapsed Elapsed time in seconds.
+/// \param n Number of tours or tourneys generated.
 
-void CGenerator::OutputTimes(FILE* output, float fCpu, float fElapsed){
+void CGenerator::OutputTimes(FILE* output, float fCpu, float fElapsed, int n){
   assert(output != 0); //safety
 
-  if(output != nullptr)
-    fprintf(output, "%d\t%0.2f\t%0.2f\n", m_nWidth, fCpu, fElapsed);
+  if(output != nullptr){
+    const double cells = (double)n*m_nSize; //number of cells generated
+    const double fPerCell = cells > 0? 1000000.0*fCpu/cells: 0; //microseconds
+
+    fprintf(output, "%d\t%0.2f\t%0.2f\t%0.3f", m_nWidth, fCpu, fElapsed,
+      fPerCell);
+  } //if
 } //OutputTimes
 
+/// Append the convergence rate of the neural network, that is, the mean
+/// number of attempts per tourney and the mean number of sweeps (updates
+/// of all neurons) per attempt, to a line of the times file. This lets
+/// the synchronous and asynchronous networks be compared per board size.
+/// \param output Pointer to file.
+/// \param n Number of tourneys generated.
+
+void CGenerator::OutputConvergence(FILE* output, int n){
+  assert(output != 0); //safety
+
+  if(output != nullptr && n > 0 && m_fAttempts > 0)
+    fprintf(output, "\t%0.2f\t%0.1f", m_fAttempts/n, m_fSweeps/m_fAttempts);
+} //OutputConvergence
+
 #pragma endregion Task::Time
 
+///////////////////////////////////////////////////////////////////
+// Code for Task::Stream
+
+#pragma region Task::Stream
+
+/// Derive many knight's tours from a few base tourneys and measure
+/// statistics on them. Each search thread generates one base tourney
+/// and then repeatedly shatters it and joins it back into a tour, so
+/// the cost per tour is a few cheap passes over a board that stays in
+/// cache instead of a complete generation. The statistics are written
+/// to a text file in the same format as Measure(). If requested, each tour
+/// is also saved to a text file whose name ends in its index in the stream.
+/// \param t Tourney descriptor for the base tourneys.
+/// \param pool Thread pool for the search threads.
+/// \param n Number of tours to stream.
+/// \param bSave Whether to save each tour, as well as its statistics.
+
+void CGenerator::Stream(const CTourneyDesc& t, CThreadPool& pool, int n,
+  bool bSave)
+{
+  const int nBases = std::max(1, std::min(pool.GetNumThreads(), n)); //number of bases
+
+  //queue up one search request per base tourney, sharing out the tours
+
+  for(int i=0; i<nBases; i++){
+    CSearchRequest request = MakeRequest(t);
+    request.m_bDiscard = !bSave; //keep the tours only if saving them
+    request.m_nStream = (int)(((INT64)i + 1)*n/nBases - (INT64)i*n/nBases);
+    m_cSearchRequest.push(request); //submit request
+  } //for
+
+  //start timing CPU and elapsed time
+
+  CTimer Timer;
+  Timer.Start();
+
+  printf("Starting %d theads at: %s", nBases, Timer.GetCurrentDateAndTime());
+
+  RunSearchThreads(pool, nBases); //run the search threads until done
+
+  const float fElapsed = Timer.GetElapsedTime(); //elapsed time in seconds
+  Timer.Finish();
+
+  if(fElapsed > 0)
+    printf("%0.1f tours per second\n", m_nResults/fElapsed);
+
+  WriteStats("Stream" + MakeFileNameBase(t, m_nWidth) //process measurements
+    + "-" + std::to_string(n) + ".txt");
+} //Stream
+
+#pragma endregion Task::Stream
+
+
+///////////////////////////////////////////////////////////////////
+// Code for Task::Benchmark
+
+#pragma region Task::Benchmark
+
+/// Measure contention on the search request queue by having every thread
+/// in the pool pop search requests as fast as it can, as CSearchThread
+/// does, but without doing the searches. This is done first with a single
+/// mutex-guarded CThreadSafeQueue, then with the CWorkStealingQueue that
+/// the search threads use, and the number of requests per second for
+/// each is printed and appended to a text file.
+/// \param t Tourney descriptor.
+/// \param pool Thread pool.
+/// \param n Number of search requests.
+
+void CGenerator::Benchmark(const CTourneyDesc& t, CThreadPool& pool, int n){
+  const int nThreads = pool.GetNumThreads(); //number of threads
+
+  CThreadSafeQueue<CSearchRequest> locked; //mutex-guarded queue
+  CWorkStealingQueue<CSearchRequest> stealing(nThreads); //work-stealing queue
+
+  for(int i=0; i<n; i++){ //queue up search requests
+    CSearchRequest request(t, m_nWidth, m_nHeight, ::rand());
+    request.m_bDiscard = true;
+    locked.push(request);
+    stealing.push(request);
+  } //for
+
+  CTimer Timer;
+
+  Timer.Start();
+  pool.Run(nThreads, [&](int){CSearchRequest r; while(locked.pop(r));});
+  const float fLocked = Timer.GetElapsedTime(); //elapsed time in seconds
+
+  Timer.Start();
+  pool.Run(nThreads, [&](int i){CSearchRequest r; while(stealing.pop(r, i));});
+  const float fStealing = Timer.GetElapsedTime(); //elapsed time in seconds
+
+  //report requests per second
+
+  const double fLockedRate = fLocked > 0? n/fLocked: 0; //locked rate
+  const double fStealingRate = fStealing > 0? n/fStealing: 0; //stealing rate
+
+  printf("%d threads, %d requests\n", nThreads, n);
+  printf("Mutex-guarded queue: %0.0f requests per second\n", fLockedRate);
+  printf("Work-stealing queue: %0.0f requests per second\n", fStealingRate);
+
+  std::string strFileName = "Contention-" + std::to_string(n) + ".txt";
+
+  FILE* output = fopen(strFileName.c_str(), "at");
+
+  if(output != nullptr){
+    fprintf(output, "%d\t%0.0f\t%0.0f\n", nThreads, fLockedRate, fStealingRate);
+    fclose(output);
+  } //if
+} //Benchmark
+
+#pragma endregion Task::Benchmark
@@ -29,8 +29,9 @@
 #include "ThreadSafeQueue.h"
 
 #include "Structs.h"
-#include "SearchThreadQueues.h"
+#include "SearchJob.h"
 #include "SearchThread.h"
+#include "ThreadPool.h"
 #include "Includes.h"
 
 #include "Defines.h"
@@ -42,27 +43,50 @@
 /// The resulting tourneys and knight's tours can either be output
 /// (single tourneys and knight's tours only), or the generation
 /// of large numbers of them can be timed, or various
-/// statistics can be measured.
+/// statistics can be measured. Each generator is a search job with its
+/// own queues, so several generators can run at once on one thread pool.
 
-class CGenerator: public CSearchThreadQueues{
+class CGenerator: public CSearchJob{
   private:
-    std::vector<std::thread> m_vecThreadList; ///< Thread list for search.
-    
     int m_nWidth = 0; ///< Board width.
     int m_nHeight = 0; ///< Board height.
-    int m_nSize = 0; ///< Board size.
+    INT64 m_nSize = 0; ///< Board size.
+    UINT m_nTimeLimit = 0; ///< Time limit per request in milliseconds, 0 for none.
+
+    CBoard* m_pBoard = nullptr; ///< Board from the first result to have one.
+    INT64 m_nResults = 0; ///< Number of results consumed.
+    double m_fSingleMean[8] = {0}; ///< Running mean of single moves.
+    double m_fSingleM2[8] = {0}; ///< Running sum of squared single deviations.
+    double m_fRelativeMean[8] = {0}; ///< Running mean of relative moves.
+    double m_fRelativeM2[8] = {0}; ///< Running sum of squared relative deviations.
+    double m_fAttempts = 0; ///< Total number of neural network attempts.
+    double m_fSweeps = 0; ///< Total number of neural network sweeps.
    
+    template<class T> void GenerateDeterministic(const CTourneyDesc& t,
+      CThreadPool& pool); ///< Deterministic.
+
+    void WriteStats(const std::string& strFileName); ///< Write statistics.
+    CSearchRequest MakeRequest(const CTourneyDesc& t); ///< Make search request.
+    void RunSearchThreads(CThreadPool& pool, int n); ///< Run search threads.
+    void ConsumeResult(CSearchResult& r); ///< Consume a search result.
     void OutputStat(FILE* output, double a[8]); ///< Output a statistic.
-    void OutputTimes(FILE* output, float fCpu, float fElapsed); ///< Output times.
+    void OutputTimes(FILE* output, float fCpu, float fElapsed,
+      int n); ///< Output times.
+    void OutputConvergence(FILE* output, int n); ///< Output convergence rate.
 
   public:
     CGenerator(int w, int h); ///< Constructor.
     CGenerator(int n); ///< Constructor.
     CGenerator(); ///< Default constructor.
+
+    void SetTimeLimit(UINT ms); ///< Set time limit per request.
     
-    void Generate(const CTourneyDesc& t, int nThreads); ///< Generate.
-    void Measure(const CTourneyDesc& t, int nThreads, int n); ///< Measure.
-    void Time(const CTourneyDesc& t, int nThreads, int n); ///< Time.
+    void Generate(const CTourneyDesc& t, CThreadPool& pool); ///< Generate.
+    void Measure(const CTourneyDesc& t, CThreadPool& pool, int n); ///< Measure.
+    void Time(const CTourneyDesc& t, CThreadPool& pool, int n); ///< Time.
+    void Stream(const CTourneyDesc& t, CThreadPool& pool, int n,
+      bool bSave=false); ///< Stream.
+    void Benchmark(const CTourneyDesc& t, CThreadPool& pool, int n); ///< Benchmark.
 }; //CGenerator
 
 #endif
@@ -25,7 +25,6 @@
 
 #include "Helpers.h"
 
-#include "Graph.h"
 #include "Random.h"
 #include "Defines.h"
 #include "Includes.h"
@@ -94,6 +93,7 @@ std::string MakeFileNameBase(const CTourneyDesc& t, int w){
   switch(gentype){ //prefix represents the generator type
     case GeneratorType::Warnsdorff:       s = "Warnsd"; break;
     case GeneratorType::TakefujiLee:      s = "Neural"; break;
+    case GeneratorType::TakefujiLeeSync:  s = "NeuSyn"; break;
     case GeneratorType::DivideAndConquer: s = "Divide"; break;
     case GeneratorType::ConcentricBraid:  s = "Braid";  break;
     case GeneratorType::FourCover:        s = "Cover4"; break;
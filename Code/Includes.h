@@ -35,17 +35,22 @@
 #include <functional>
 #include <algorithm>
 #include <cmath>
+#include <climits>
 
 #include <string>
 #include <vector>
 #include <queue>
+#include <deque>
 #include <set>
+#include <map>
+#include <memory>
 
 //multi-threading includes
 
 #include <atomic>
 #include <mutex>
 #include <thread>
+#include <condition_variable>
 
 #include <ctime>
 #include <chrono>
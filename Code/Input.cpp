@@ -96,6 +96,18 @@ bool ReadBoardSize(UINT& n, const CTourneyDesc& t){
   return ReadUnsigned(n, parity, lo);
 } //ReadBoardSize
 
+/// Read the time limit for each search, in milliseconds, with 0 meaning
+/// no limit. ReadUnsigned(UINT&, Parity, UINT) is called to read from
+/// the user until they enter an unsigned integer, or the letter 'r' to
+/// restart.
+/// \param ms [out] The time limit typed by the user.
+/// \return true If the user wants to restart instead.
+
+bool ReadTimeLimit(UINT& ms){
+  printf("Enter time limit per search in milliseconds, or 0 for none.\n");
+  return ReadUnsigned(ms, Parity::DontCare, 0);
+} //ReadTimeLimit
+
 /// \brief Read a single character from stdin.
 ///
 /// This function will return only when the user types a
@@ -140,6 +152,7 @@ char ReadCharacter(std::set<char>& s){
 void PrintGeneratorTypeHelp(){
   printf("   w: random walk with Warnsdorff's heuristic\n");
   printf("   t: Takefuji-Lee neural network\n");
+  printf("   s: Takefuji-Lee neural network with synchronous update\n");
   printf("   d: divide-and-conquer\n");
   printf("   c: concentric braid\n");
   printf("   4: 4-cover\n");
@@ -153,10 +166,10 @@ bool ReadGeneratorType(GeneratorType& t){
   bool finished = false;
 
   while(!finished){
-    printf("Enter generation algorithm [wtdc4], h for help, r to restart.\n");
+    printf("Enter generation algorithm [wtsdc4], h for help, r to restart.\n");
     finished = true;
 
-    std::set<char> s = {'w', 't', 'd', 'c', 'h', '4', 'r'}; //admissible chars
+    std::set<char> s = {'w', 't', 's', 'd', 'c', 'h', '4', 'r'}; //admissible chars
     const char c = ReadCharacter(s); //read admissible character from user
     
     //decode character entered by user into a generator type and print response
@@ -174,6 +187,11 @@ bool ReadGeneratorType(GeneratorType& t){
         printf("Takefuji-Lee neural network algorithm selected.\n");
         break;
 
+      case 's': 
+        t = GeneratorType::TakefujiLeeSync; 
+        printf("Synchronous Takefuji-Lee neural network algorithm selected.\n");
+        break;
+
       case 'd':
         t = GeneratorType::DivideAndConquer;
         printf("Divide-and-conquer algorithm selected.\n");
@@ -257,19 +275,23 @@ bool ReadCycleType(CycleType& t){
 
 /// Read a character from stdin and decode it into obfuscate status.
 /// \param obfuscate [out] true if the user requests blurring.
+/// \param rounds [out] Number of shatters, or ADAPTIVE to shatter until mixed.
 /// \return true If the user wants to restart instead.
 
-bool ReadObfuscate(bool& obfuscate){
-  printf("Obfuscated [yn], r to restart?\n");
+bool ReadObfuscate(bool& obfuscate, int& rounds){
+  printf("Obfuscated [yn], a for adaptive, r to restart?\n");
 
-  std::set<char> s = {'y', 'n', 'r'}; //admissible characters
+  std::set<char> s = {'y', 'n', 'a', 'r'}; //admissible characters
   const char c = ReadCharacter(s); //read admissible character from user
-  obfuscate = c == 'y'; //yes to obfuscate
+  obfuscate = c == 'y' || c == 'a'; //yes to obfuscate
+  rounds = (c == 'a')? ADAPTIVE: SHATTER_ROUNDS; //a to shatter until mixed
 
   const bool bRestart = c == 'r'; //r to restart
 
   if(!bRestart){
-    if(obfuscate)
+    if(c == 'a')
+      printf("Obfuscating until mixed.\n");
+    else if(obfuscate)
       printf("Obfuscating.\n");
     else
       printf("No obfuscation\n");
@@ -278,12 +300,29 @@ bool ReadObfuscate(bool& obfuscate){
   return bRestart; 
 } //ReadObfuscate
 
+/// Read a character from stdin and decode it into whether to save each
+/// of a stream of tours.
+/// \param save [out] true if the user wants each tour saved.
+/// \return true If the user wants to restart instead.
+
+bool ReadSaveTours(bool& save){
+  printf("Save each tour [yn], r to restart?\n");
+
+  std::set<char> s = {'y', 'n', 'r'}; //admissible characters
+  const char c = ReadCharacter(s); //read admissible character from user
+  save = c == 'y'; //yes to save
+
+  return c == 'r'; //r to restart
+} //ReadSaveTours
+
 /// Print keyboard mapping for tasks.
 
 void PrintTaskHelp(){
   printf("   g: generate and save a single tourney\n");
   printf("   m: measure statistics on many tourneys of the same size\n");
   printf("   t: time the generation of many tourneys for a size range\n");
+  printf("   s: stream many tours derived from one tourney by shatter and join\n");
+  printf("   b: benchmark contention on the search request queue\n");
 } //PrintTaskHelp
 
 /// Read a character from stdin and decode it into a task.
@@ -294,10 +333,10 @@ bool ReadTask(Task& t){
   bool finished = false;
 
   while(!finished){
-    printf("Select task [gmt], h for help, q to quit.\n");
+    printf("Select task [gmtsb], h for help, q to quit.\n");
     finished = true;
 
-    std::set<char> s = {'g', 'm', 't', 'h', 'q'}; //admissible characters
+    std::set<char> s = {'g', 'm', 't', 's', 'b', 'h', 'q'}; //admissible characters
     const char cTask = ReadCharacter(s); //read admissible character from user
 
     //decode character entered by user into a task and print response
@@ -320,6 +359,16 @@ bool ReadTask(Task& t){
         printf("Timing the generation of tourneys.\n");
         break;
 
+      case 's':
+        t = Task::Stream;
+        printf("Streaming tours derived by shatter and join.\n");
+        break;
+
+      case 'b':
+        t = Task::Benchmark;
+        printf("Benchmarking the search request queue.\n");
+        break;
+
       case 'h': 
         PrintTaskHelp(); 
         finished = false; 
@@ -32,9 +32,11 @@
 bool ReadUnsigned(UINT& n, Parity parity, UINT lo); ///< Read a UINT from stdin.
 
 bool ReadBoardSize(UINT& n, const CTourneyDesc& t); ///< Read board size from stdin.
+bool ReadTimeLimit(UINT& ms); ///< Read time limit from stdin.
 bool ReadGeneratorType(GeneratorType& t); ///< Read the generator type from stdin.
 bool ReadCycleType(CycleType& t); ///< Read the cycle type from stdin.
-bool ReadObfuscate(bool& obfuscate); ///< Read obfuscate status from stdin.
+bool ReadObfuscate(bool& obfuscate, int& rounds); ///< Read obfuscate status from stdin.
+bool ReadSaveTours(bool& save); ///< Read whether to save streamed tours from stdin.
 bool ReadTask(Task& t); ///< Read the task from stdin.
 
 #endif
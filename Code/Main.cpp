@@ -32,6 +32,7 @@
 #include "Input.h"
 #include "Generator.h"
 #include "Task.h"
+#include "ThreadPool.h"
 #include "Helpers.h"
 
 /// \brief Main.
@@ -44,10 +45,14 @@ int main(){
  
   srand(timeGetTime()); //we'll use ::rand() later to seed a better PRNG
 
+  CThreadPool pool(nNumThreads); //search threads, shared by all tasks
+
   //print banner
 
   printf("Ian Parberry's square tourney generator");
-  printf(" with %d concurrent threads.\n", nNumThreads);
+  printf(" with %d concurrent threads.\n", pool.GetNumThreads());
+  printf("Thread startup took %0.2f milliseconds.\n", 
+    1000.0f*pool.GetStartupTime());
   printf("-------------------------------------------------------------------");
   putchar('\n');
 
@@ -79,10 +84,12 @@ int main(){
 
         if(!bRestart){
           bool obfuscate = false; //obfuscate flag
-          bool bRestart = ReadObfuscate(obfuscate); //get the obfuscate flag
+          int rounds = SHATTER_ROUNDS; //number of shatters to obfuscate
+          bool bRestart = ReadObfuscate(obfuscate, rounds); //get obfuscate flag
           
           if(!bRestart) //start the task
-            StartTask(task, CTourneyDesc(gentype, cycletype, obfuscate), nNumThreads);       
+            StartTask(task, 
+              CTourneyDesc(gentype, cycletype, obfuscate, rounds), pool);       
         } //if
       } //if
     } //while
@@ -1,5 +1,5 @@
 /// \file Rail.cpp
-/// \brief Code for CRail.
+/// \brief Code for CRailT.
 
 // MIT License
 //
@@ -29,46 +29,26 @@
 
 #include "Rail.h"
 
-extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves. 
-
 /// The rail constructor stores the indexes of the source and
 /// destination cells of two knight's moves in which the two source
 /// cells are separated by a knight's move and the two destination
-/// are separated by a knight's move. If the parameters fail these
-/// constraints then all four indices are set to UNUSED.
+/// are separated by a knight's move. It is up to the caller to check
+/// these constraints, which is done using the board's move tables in
+/// CBoardT::IsRail().
 /// \param src0 Index of cell at source end of first move.
 /// \param dest0 Index of cell at destination end of first move.
 /// \param src1 Index of cell at source end of second move.
 /// \param dest1 Index of cell at the destination end of second move.
-/// \param w Board width.
 
-CRail::CRail(int src0, int dest0, int src1, int dest1, UINT w):
-  m_nSrc0(src0), m_nDest0(dest0), m_nSrc1(src1), m_nDest1(dest1), m_nWidth(w){   
+template<class T> CRailT<T>::CRailT(T src0, T dest0, T src1, T dest1):
+  m_nSrc0(src0), m_nDest0(dest0), m_nSrc1(src1), m_nDest1(dest1){   
 } //constructor
 
-/// Test whether two cells are separated by a knight's move. Assumes that
-/// the board width m_nWidth has been set by the constructor.
-/// \param i Board cell index.
-/// \param j Board cell index.
-/// \return true if j is a knight's move from i (and vice-versa)
-
-bool CRail::IsKnightMove(int i, int j){
-  for(MoveDelta delta: g_vecDeltas){
-    const int x = i%m_nWidth + delta.first;
-    const int y = i/m_nWidth + delta.second;
-
-    if(j == y*m_nWidth + x)
-      return true;
-  } //for
-
-  return false;
-} //IsKnightMove
-
 /// Reader function for the first edge.
 /// \param src [out] Source vertex for the first edge.
 /// \param dest [out] Source vertex for the first edge.
 
-void CRail::GetEdge0(int& src, int& dest){
+template<class T> void CRailT<T>::GetEdge0(T& src, T& dest){
   src = m_nSrc0;
   dest = m_nDest0;
 } //GetEdge0
@@ -77,7 +57,14 @@ void CRail::GetEdge0(int& src, int& dest){
 /// \param src [out] Source vertex for the second edge.
 /// \param dest [out] Source vertex for the second edge.
 
-void CRail::GetEdge1(int& src, int& dest){
+template<class T> void CRailT<T>::GetEdge1(T& src, T& dest){
   src = m_nSrc1;
   dest = m_nDest1;
-} //GetEdge1
\ No newline at end of file
+} //GetEdge1
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template class CRailT<int>; ///< Rail with 32-bit cell indices.
+template class CRailT<INT64>; ///< Rail with 64-bit cell indices.
@@ -1,5 +1,5 @@
 /// \file Rail.h
-/// \brief Header for CRail.
+/// \brief Header for CRailT.
 
 // MIT License
 //
@@ -37,24 +37,24 @@
 /// end points are shown in gray).
 ///
 /// \image html rails.png
+///
+/// The rail is a template over the type of cell indices used by the board.
 
-class CRail{
+template<class T> class CRailT{
   private:
-    int m_nSrc0 = UNUSED; ///< Index of cell at one end of first edge.
-    int m_nDest0 = UNUSED; ///< Index of cell at the other end of first edge.
+    T m_nSrc0 = UNUSED; ///< Index of cell at one end of first edge.
+    T m_nDest0 = UNUSED; ///< Index of cell at the other end of first edge.
   
-    int m_nSrc1 = UNUSED; ///< Index of cell at one end of second edge.
-    int m_nDest1 = UNUSED; ///< Index of cell at the other end of second edge.
-
-    int m_nWidth = 0; ///< Width of chessboard.
-
-    bool IsKnightMove(int i, int j); ///< Knight's move test.
+    T m_nSrc1 = UNUSED; ///< Index of cell at one end of second edge.
+    T m_nDest1 = UNUSED; ///< Index of cell at the other end of second edge.
 
   public:
-    CRail(int src0, int dest0, int src1, int dest1, UINT w); ///< Constructor.
+    CRailT(T src0, T dest0, T src1, T dest1); ///< Constructor.
+
+    void GetEdge0(T& src, T& dest); ///< Get first edge.
+    void GetEdge1(T& src, T& dest); ///< Get second edge.
+  }; //CRailT
 
-    void GetEdge0(int& src, int& dest); ///< Get first edge.
-    void GetEdge1(int& src, int& dest); ///< Get second edge.
-  }; //CRail
+typedef CRailT<int> CRail; ///< Rail with 32-bit cell indices.
 
 #endif
@@ -73,6 +73,18 @@ UINT CRandom::randn(UINT i, UINT j){
   return randn()%(j - i + 1) + i;
 } //randn
 
+/// Generate a pseudorandom 64-bit unsigned integer within a range, for ranges
+/// too large for randn(UINT, UINT). Two 32-bit pseudorandom numbers are glued
+/// together to make a 64-bit one.
+/// \param i Bottom of range.
+/// \param j Top of range.
+/// \return A random positive integer r such that i \f$\leq\f$ r \f$\leq\f$ j.
+
+UINT64 CRandom::randn64(UINT64 i, UINT64 j){  
+  const UINT64 r = (UINT64)randn() << 32 | randn();
+  return r%(j - i + 1) + i;
+} //randn64
+
 /// Generate a pseudorandom floating positive point number in \f$[0,1]\f$ by
 /// generating a pseudorandom unsigned integer and dividing it by 
 /// \f$2^{32} - 1\f$. Although the result is a float, the internal
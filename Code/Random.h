@@ -46,6 +46,7 @@ class CRandom{
 
     UINT randn(); ///< Get a random unsigned integer.
     UINT randn(UINT i, UINT j); ///< Get random number in \f$[i,j]\f$.
+    UINT64 randn64(UINT64 i, UINT64 j); ///< Get 64-bit random number in \f$[i,j]\f$.
     float randf(); ///< Get a random floating point number.
     void randclr(UINT rgb[3]); ///< Get a random color.
 }; //CRandom
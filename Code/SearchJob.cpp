@@ -1,5 +1,5 @@
-/// \file SearchThreadQueues.cpp
-/// \brief Code for the search thread queues CSearchThreadQueues.
+/// \file SearchJob.cpp
+/// \brief Code for the search job CSearchJob.
 
 // MIT License
 //
@@ -23,10 +23,10 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 // IN THE SOFTWARE.
 
-#include "SearchThreadQueues.h"
+#include "SearchJob.h"
 
-CThreadSafeQueue<CSearchRequest> 
-  CSearchThreadQueues::m_cSearchRequest; ///< Search request queue.
+/// Create a search job with empty queues that has not yet finished.
 
-CThreadSafeQueue<CSearchResult>
-  CSearchThreadQueues::m_cSearchResult;  ///< Search result queue.
\ No newline at end of file
+CSearchJob::CSearchJob(): m_bFinished(false), m_nTimedOut(0),
+  m_nStreamed(0){
+} //constructor
@@ -0,0 +1,59 @@
+/// \file SearchJob.h
+/// \brief Header for the search job CSearchJob.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __SearchJob__
+#define __SearchJob__
+
+#include "ThreadSafeQueue.h"
+#include "BoundedQueue.h"
+#include "WorkStealingQueue.h"
+#include "Structs.h"
+
+/// \brief Search job.
+///
+/// The state shared by the search threads that work on one job, that is, a
+/// thread-safe input queue of search requests, a thread-safe output queue
+/// of search results, a flag that tells the search threads to stop, a
+/// count of the requests that ran out of time, and a count of the streamed
+/// tours saved so far, which numbers their files.
+/// Each job has its own, and the search threads are given the job to work
+/// on, so several jobs can be run at once on the same thread pool without
+/// their requests, results, or cancellation getting mixed up.
+
+class CSearchJob{
+  friend class CSearchThread;
+
+  protected:
+    CWorkStealingQueue<CSearchRequest> m_cSearchRequest; ///< Search request queue.
+    CBoundedQueue<CSearchResult> m_cSearchResult; ///< Search result queue.
+    std::atomic_bool m_bFinished; ///< Search termination flag.
+    std::atomic_int m_nTimedOut; ///< Number of requests that timed out.
+    std::atomic_int m_nStreamed; ///< Number of streamed tours saved.
+
+  public:
+    CSearchJob(); ///< Constructor.
+}; //CSearchJob
+
+#endif
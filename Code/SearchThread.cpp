@@ -31,27 +31,36 @@
 #include "ConcentricBraid.h"
 #include "FourCover.h"
 
-extern std::atomic_bool g_bFinished; ///< Search termination flag.
+/// Construct a search thread.
+/// \param job The search job to work on.
+/// \param worker Worker index, which selects the request deque to use first.
+
+CSearchThread::CSearchThread(CSearchJob& job, int worker):
+  m_cJob(job), m_nWorker(worker){
+} //constructor
 
 /// The function executed by a search thread, which repeatedly pops
-/// a search request from the thread-safe request queue m_cSearchRequest
+/// a search request from the job's work-stealing request queue
 /// and calls Generate() to perform the requested search.
 /// The thread terminates when the request queue is empty.
 
 void CSearchThread::operator()(){
   CSearchRequest request; //current search request
 
-  while(m_cSearchRequest.pop(request)) //grab a search request from the queue
+  while(m_cJob.m_cSearchRequest.pop(request, m_nWorker)) //grab a search request
     Generate(request); //perform search
 } //operator()()
 
 /// Generate a knight's tour or tourney according to a search request.
+/// The request's cancellation token is started here, so its time limit
+/// covers the search and not the time spent waiting in the queue. A search
+/// that is cancelled part way through leaves an incomplete board, which
+/// is discarded.
 /// \param request Search request.
 
 void CSearchThread::Generate(CSearchRequest& request){ 
   const int w = request.m_nWidth;
   const int h = request.m_nHeight;
-  const int n = request.m_nSize;
 
   CBoard* pBoard = new CBoard(w, h); //pointer to chessboard
 
@@ -59,63 +68,144 @@ void CSearchThread::Generate(CSearchRequest& request){
   const CycleType cycletype = request.m_cTourneyDesc.m_eCycle; //tour or tourney
   const bool obfuscate = request.m_cTourneyDesc.m_bObfuscate; //whether to obfuscate
   const int seed = request.m_nSeed; //PRNG seed
+  const CCancelToken* pCancel = &request.m_cCancel; //cancellation token
+
+  m_nAttempts = m_nSweeps = 0;
+  request.m_cCancel.Start(); //start the clock
  
   switch(gentype){
     case GeneratorType::Warnsdorff:
-      CWarnsdorff(seed).Generate(*pBoard, cycletype);
+      CWarnsdorff(seed, pCancel).Generate(*pBoard, cycletype);
       break; 
 
-    case GeneratorType::TakefujiLee:
-      CTakefujiLee(w, h, seed).Generate(*pBoard); //can only generate tourneys
+    case GeneratorType::TakefujiLee: //can only generate tourneys
+    case GeneratorType::TakefujiLeeSync:{
+      CTakefujiLee net(w, h, seed, gentype == GeneratorType::TakefujiLeeSync,
+        pCancel);
+      net.Generate(*pBoard, request.m_pPool);
+      m_nAttempts = net.GetNumAttempts(); //for convergence statistics
+      m_nSweeps = net.GetNumSweeps();
       break; 
+    } //case
 
     case GeneratorType::DivideAndConquer: 
-      CDivideAndConquer().Generate(*pBoard, cycletype);
+      CDivideAndConquer().Generate(*pBoard, cycletype, nullptr, pCancel);
       break;
 
     case GeneratorType::ConcentricBraid: //can only generate tourneys
-      CConcentricBraid().Generate(*pBoard);
+      CConcentricBraid().Generate(*pBoard, pCancel);
+      break;
 
     case GeneratorType::FourCover: //can only generate tourneys
-      CFourCover().Generate(*pBoard);
+      CFourCover().Generate(*pBoard, pCancel);
   } //switch
 
   //post-processing tourney
 
   if(cycletype == CycleType::TourFromTourney) //make tour from tourney
-    pBoard->JoinUntilTour();
-
-  if(obfuscate)pBoard->Obfuscate(); //obfuscate
- 
-  if(request.m_bDiscard){ //report statistics
-    CSearchResult result(nullptr, request.m_cTourneyDesc);
+    pBoard->JoinUntilTour(nullptr, pCancel);
 
-    for(int i=0; i<n; i++){ //for each cell
-      int dest = (*pBoard)[i]; //destination after one move
-      int dest2 = (*pBoard)[dest]; //destination after two moves
+  if(obfuscate) //obfuscate
+    pBoard->Obfuscate(request.m_cTourneyDesc.m_nShatterRounds, nullptr, pCancel);
 
-      const int n = pBoard->GetMoveIndex(i, dest); //1st move index in 0..7
+  if(request.m_nStream > 0){ //derive a family of tours from this one
+    if(!pCancel->IsCancelled())
+      Stream(*pBoard, request);
 
-      if(0 <= n && n < 8){ //safety
-        result.m_nSingleMove[n]++; //record single move
+    if(pCancel->HasTimedOut()) //ran out of time part way through
+      m_cJob.m_nTimedOut++;
 
-        int n2 = pBoard->GetMoveIndex(dest, dest2) - n;
-        if(n2 < 0)n2 += 8;  //2nd move index in 0..7, relative to 1st move
-        result.m_nRelativeMove[n2]++; //record double move
-      } //if
-    } //for
-    
-    m_cSearchResult.push(result); 
     delete pBoard;
   } //if
 
-  else{ //we are tasked with generating a single tour
-    if(!g_bFinished){ //report generated tour
-      g_bFinished = true; //signal other threads to terminate 
-      m_cSearchResult.push(CSearchResult(pBoard, request.m_cTourneyDesc)); 
-    } //if
+  else if(pCancel->IsCancelled()){ //the board is not to be trusted
+    if(pCancel->HasTimedOut()) //ran out of time, rather than being overtaken
+      m_cJob.m_nTimedOut++;
 
+    delete pBoard;
+  } //else if
+
+  else if(request.m_bDiscard){ //report statistics
+    ReportStats(*pBoard, request.m_cTourneyDesc);
+    delete pBoard;
+  } //else if
+
+  else{ //we are tasked with generating a single tour
+    if(!m_cJob.m_bFinished.exchange(true)) //first, so signal others to terminate
+      m_cJob.m_cSearchResult.push(CSearchResult(pBoard, request.m_cTourneyDesc)); 
     else delete pBoard;
   } //else
 } //Generate
 
+/// Derive a family of knight's tours from a base tour or tourney by
+/// repeatedly shattering it and joining the pieces back into a tour,
+/// reporting statistics on each tour in turn and, unless the request says
+/// to discard them, saving each tour to a text file whose name ends in its
+/// index in the job's stream. The same board is reused for every tour, so
+/// each one costs a few linear-time passes over a board that is already in
+/// cache instead of a fresh generation. If the pieces can't all be joined,
+/// the board is shattered again, and the stream gives up after too many
+/// failures in a row. The stream stops at the first tour that is cancelled
+/// before it is finished.
+/// \param b Base tour or tourney, which is overwritten.
+/// \param request Search request.
+
+void CSearchThread::Stream(CBoard& b, const CSearchRequest& request){
+  const int rounds = STREAM_SHATTER_ROUNDS; //shatters between tours
+  const CTourneyDesc& t = request.m_cTourneyDesc; //shorthand
+
+  int count = 0; //number of tours streamed so far
+  int failures = 0; //number of failed joins in a row
+
+  while(count < request.m_nStream && failures < STREAM_MAX_FAILURES){
+    b.Obfuscate(rounds, nullptr, &request.m_cCancel); //shatter and join into next tour
+    if(request.m_cCancel.IsCancelled())break; //incomplete, so don't report it
+
+    if(!b.IsTour()){ //the pieces couldn't all be joined
+      failures++;
+      continue; //shatter again
+    } //if
+
+    failures = 0;
+    ReportStats(b, t);
+
+    if(!request.m_bDiscard){ //save it under its index in the stream
+      std::string s = MakeFileNameBase(t, b.GetWidth()) + "-" + 
+        std::to_string(m_cJob.m_nStreamed++);
+      b.Save(s);
+    } //if
+
+    count++;
+  } //while
+} //Stream
+
+/// Count the single and relative moves in a tour or tourney and push
+/// them onto the result queue.
+/// \param b Chessboard.
+/// \param t Tourney descriptor.
+
+void CSearchThread::ReportStats(CBoard& b, const CTourneyDesc& t){
+  CSearchResult result(nullptr, t);
+  result.m_nAttempts = m_nAttempts;
+  result.m_nSweeps = m_nSweeps;
+
+  const int size = b.GetSize(); //board size
+
+  for(int i=0; i<size; i++){ //for each cell
+    int dest = b[i]; //destination after one move
+    int dest2 = b[dest]; //destination after two moves
+
+    const int n = b.GetMoveIndex(i, dest); //1st move index in 0..7
+
+    if(0 <= n && n < 8){ //safety
+      result.m_nSingleMove[n]++; //record single move
+
+      int n2 = b.GetMoveIndex(dest, dest2) - n;
+      if(n2 < 0)n2 += 8;  //2nd move index in 0..7, relative to 1st move
+      result.m_nRelativeMove[n2]++; //record double move
+    } //if
+  } //for
+    
+  m_cJob.m_cSearchResult.push(result); 
+} //ReportStats
+
@@ -28,7 +28,7 @@
 
 #include "Includes.h"
 
-#include "SearchThreadQueues.h"
+#include "SearchJob.h"
 #include "Random.h"
 #include "Helpers.h"
 
@@ -36,13 +36,22 @@
 ///
 /// The code that is run in each search thread, consisting of the generation
 /// code and an override for operator() so that threads can be created
-/// in the approved C++ manner.
+/// in the approved C++ manner. Each search thread works on a single search
+/// job, from which it takes its requests and to which it reports results.
 
-class CSearchThread: public CSearchThreadQueues{
+class CSearchThread{
   private:
+    CSearchJob& m_cJob; ///< The search job being worked on.
+    int m_nAttempts = 0; ///< Neural network resets for the current request.
+    int m_nSweeps = 0; ///< Neural network updates for the current request.
+    int m_nWorker = 0; ///< Worker index for the request queue.
+
     void Generate(CSearchRequest& request); ///< Generate knight's tour/tourney.
+    void Stream(CBoard& b, const CSearchRequest& request); ///< Stream tours.
+    void ReportStats(CBoard& b, const CTourneyDesc& t); ///< Report statistics.
 
   public:
+    CSearchThread(CSearchJob& job, int worker=0); ///< Constructor.
     void operator()(); ///< The code that gets run by each thread.
 }; //CSearchThread
 
@@ -35,9 +35,13 @@ extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves.
 /// \param gen Generator type.
 /// \param c Cycle type.
 /// \param obfuscate True to obfuscate (defaults to false).
+/// \param rounds Number of shatters to obfuscate, or ADAPTIVE to shatter
+/// until the tourney is mixed (defaults to SHATTER_ROUNDS).
 
-CTourneyDesc::CTourneyDesc(GeneratorType gen, CycleType c, bool obfuscate):
-  m_eGenerator(gen), m_eCycle(c), m_bObfuscate(obfuscate){
+CTourneyDesc::CTourneyDesc(GeneratorType gen, CycleType c, bool obfuscate,
+  int rounds):
+  m_eGenerator(gen), m_eCycle(c), m_bObfuscate(obfuscate), 
+  m_nShatterRounds(rounds){
 } //CTourneyDesc
 
 /// The default tourney descriptor constructor. 
@@ -28,8 +28,11 @@
 
 #include "Includes.h"
 #include "Defines.h"
+#include "CancelToken.h"
 
-class CBoard; //forward declaration
+template<class T> class CBoardT; //forward declaration
+class CThreadPool; //forward declaration
+typedef CBoardT<int> CBoard; ///< Chessboard with 32-bit cell indices.
 
 /////////////////////////////////////////////////////////////////////////
 
@@ -41,8 +44,10 @@ struct CTourneyDesc{
   GeneratorType m_eGenerator = GeneratorType::Unknown; ///< Generator type.
   CycleType m_eCycle =  CycleType::Unknown; ///< Cycle type.
   bool m_bObfuscate = false; ///< Whether to obfuscate.
+  int m_nShatterRounds = SHATTER_ROUNDS; ///< Shatters to obfuscate, or ADAPTIVE.
 
-  CTourneyDesc(GeneratorType gen, CycleType c, bool obfuscate=false); ///< Constructor.
+  CTourneyDesc(GeneratorType gen, CycleType c, bool obfuscate=false,
+    int rounds=SHATTER_ROUNDS); ///< Constructor.
   CTourneyDesc(); ///< Default constructor.
 }; //CTourneyDesc
 
@@ -60,8 +65,11 @@ struct CSearchRequest{
   int m_nSize = 0; ///< Board size.
 
   bool m_bDiscard = false; ///< Discard result.
+  int m_nStream = 0; ///< Number of tours to derive from this one.
+  CThreadPool* m_pPool = nullptr; ///< Thread pool for this search, if any.
 
   int m_nSeed = 0; ///< PRNG seed.
+  CCancelToken m_cCancel; ///< Cancellation token.
 
   CSearchRequest(const CTourneyDesc& t, int w, int h, int s); ///< Constructor.
   CSearchRequest(); ///< Default constructor.
@@ -84,6 +92,9 @@ struct CSearchResult{
 
   UINT64 m_nSingleMove[8] = {0}; ///< Single move count.
   UINT64 m_nRelativeMove[8] = {0}; ///< Double move count.
+
+  int m_nAttempts = 0; ///< Number of neural network resets.
+  int m_nSweeps = 0; ///< Number of neural network updates.
     
   CSearchResult(CBoard* b, const CTourneyDesc& t); ///< Constructor.
   CSearchResult(); ///< Default constructor.
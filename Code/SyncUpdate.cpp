@@ -0,0 +1,190 @@
+/// \file SyncUpdate.cpp
+/// \brief Code for the synchronous neural network update kernels.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "SyncUpdate.h"
+
+//The AVX2 kernel is compiled for x86 only. GCC and Clang are told to
+//generate AVX2 code for that one function, and Visual Studio allows AVX2
+//intrinsics anywhere, so no compiler flags are needed and the rest of the
+//program still runs on CPUs without AVX2.
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define SYNC_UPDATE_X86 ///< Whether the AVX2 kernel can be compiled.
+
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+    #include <immintrin.h>
+    #define TARGET_AVX2 ///< Visual Studio needs no target attribute.
+  #else
+    #include <immintrin.h>
+    #define TARGET_AVX2 __attribute__((target("avx2"))) ///< Compile for AVX2.
+  #endif
+#endif
+
+/// Update a run of neurons one at a time using the rule in
+/// CTakefujiLee::UpdateSynchronous(). Each neuron that has won the coin toss
+/// adds 4 minus the degrees of its ends to its state, and its output
+/// switches on if its state is more than 3 and off if it is negative.
+/// \param state [in, out] Neuron states.
+/// \param output [in, out] Neuron outputs.
+/// \param mask 1 for a neuron, 0 for padding.
+/// \param coin 1 if the neuron applies its change this time, 0 otherwise.
+/// \param degree0 Degree of the first end of each neuron.
+/// \param degree1 Degree of the second end of each neuron.
+/// \param n Number of neurons in the run.
+/// \return Nonzero if some neuron that isn't masked out was unstable.
+
+int SyncUpdateScalar(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, int n)
+{
+  int changed = 0; //nonzero if any neuron was not stable
+
+  for(int p=0; p<n; p++){
+    const short delta = (short)(4 - degree0[p] - degree1[p]);
+    const short newstate = state[p] + coin[p]*delta;
+
+    state[p] = newstate;
+    output[p] = (BYTE)((newstate > 3) | (output[p] & (newstate >= 0)));
+    changed |= mask[p]*delta;
+  } //for
+
+  return changed;
+} //SyncUpdateScalar
+
+#if defined(SYNC_UPDATE_X86)
+
+/// Load 16 bytes and widen them into the 16-bit lanes of an AVX2 register.
+/// \param a Pointer to the first byte.
+/// \return The bytes as 16-bit integers.
+
+static TARGET_AVX2 __m256i Widen(const BYTE* a){
+  return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)a));
+} //Widen
+
+/// Update a run of neurons exactly as SyncUpdateScalar() does, but 16 at a
+/// time in 16-bit lanes using AVX2. The 8-bit inputs are widened to 16 bits,
+/// and the outputs are narrowed back to 8 bits with unsigned saturation,
+/// which can't saturate since they are 0 or 1. The leftover neurons at the
+/// end of the run are done by SyncUpdateScalar(). Only call this if
+/// HasAVX2() returns true.
+/// \param state [in, out] Neuron states.
+/// \param output [in, out] Neuron outputs.
+/// \param mask 1 for a neuron, 0 for padding.
+/// \param coin 1 if the neuron applies its change this time, 0 otherwise.
+/// \param degree0 Degree of the first end of each neuron.
+/// \param degree1 Degree of the second end of each neuron.
+/// \param n Number of neurons in the run.
+/// \return Nonzero if some neuron that isn't masked out was unstable.
+
+TARGET_AVX2 int SyncUpdateAVX2(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, int n)
+{
+  const __m256i four = _mm256_set1_epi16(4);
+  const __m256i three = _mm256_set1_epi16(3);
+  const __m256i minus1 = _mm256_set1_epi16(-1);
+  const __m256i one = _mm256_set1_epi16(1);
+
+  __m256i changed = _mm256_setzero_si256(); //nonzero lanes are unstable
+  int p = 0; //neuron index
+
+  for(; p + 16<=n; p+=16){
+    const __m256i delta = _mm256_sub_epi16(_mm256_sub_epi16(four, 
+      Widen(degree0 + p)), Widen(degree1 + p));
+    const __m256i oldstate = _mm256_loadu_si256((const __m256i*)(state + p));
+    const __m256i newstate = _mm256_add_epi16(oldstate, 
+      _mm256_mullo_epi16(Widen(coin + p), delta));
+
+    _mm256_storeu_si256((__m256i*)(state + p), newstate);
+
+    const __m256i on = _mm256_and_si256(one, 
+      _mm256_cmpgt_epi16(newstate, three)); //state > 3
+    const __m256i keep = _mm256_and_si256(Widen(output + p), 
+      _mm256_cmpgt_epi16(newstate, minus1)); //old output if state >= 0
+    const __m256i out = _mm256_or_si256(on, keep); //new outputs
+
+    _mm_storeu_si128((__m128i*)(output + p), _mm_packus_epi16(
+      _mm256_castsi256_si128(out), _mm256_extracti128_si256(out, 1)));
+
+    changed = _mm256_or_si256(changed, 
+      _mm256_mullo_epi16(Widen(mask + p), delta));
+  } //for
+
+  const int tail = SyncUpdateScalar(state + p, output + p, mask + p, 
+    coin + p, degree0 + p, degree1 + p, n - p); //leftover neurons
+
+  return tail | !_mm256_testz_si256(changed, changed);
+} //SyncUpdateAVX2
+
+#else
+
+/// Stand-in for the AVX2 kernel on CPUs that aren't x86, where HasAVX2()
+/// is always false. The parameters are as for SyncUpdateScalar(), which
+/// it calls.
+
+int SyncUpdateAVX2(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, int n)
+{
+  return SyncUpdateScalar(state, output, mask, coin, degree0, degree1, n);
+} //SyncUpdateAVX2
+
+#endif
+
+/// Determine whether the CPU supports AVX2 and the operating system saves
+/// the AVX registers on a context switch. Under Visual Studio this is
+/// read from CPUID and XGETBV, elsewhere the compiler does it for us.
+/// \return true If the AVX2 kernel can be used.
+
+bool HasAVX2(){
+  #if !defined(SYNC_UPDATE_X86)
+    return false;
+  #elif defined(_MSC_VER)
+    int info[4]; //registers eax, ebx, ecx, edx
+
+    __cpuid(info, 0);
+    if(info[0] < 7)return false; //no extended features leaf
+
+    __cpuid(info, 1);
+    const int osxsave = 1 << 27; //OS uses XSAVE
+    const int avx = 1 << 28; //CPU supports AVX
+    if((info[2] & (osxsave | avx)) != (osxsave | avx))return false;
+    if((_xgetbv(0) & 6) != 6)return false; //OS doesn't save the AVX registers
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0; //AVX2 bit
+  #else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  #endif
+} //HasAVX2
+
+/// Get the fastest synchronous update kernel that this CPU can run. The
+/// CPU is only checked the first time.
+/// \return SyncUpdateAVX2 if the CPU supports AVX2, SyncUpdateScalar if not.
+
+SyncUpdateKernel GetSyncUpdateKernel(){
+  static const SyncUpdateKernel kernel = 
+    HasAVX2()? SyncUpdateAVX2: SyncUpdateScalar; //thread-safe in C++11
+  return kernel;
+} //GetSyncUpdateKernel
@@ -0,0 +1,54 @@
+/// \file SyncUpdate.h
+/// \brief Header for the synchronous neural network update kernels.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __SyncUpdate__
+#define __SyncUpdate__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Synchronous update kernel.
+///
+/// A function that updates a run of consecutive neurons in one of the
+/// padded grids used by the synchronous mode of CTakefujiLee. The arrays
+/// all start at the first neuron of the run, and degree1 is the degree
+/// array offset by the move, so that the two ends of neuron p have degrees
+/// degree0[p] and degree1[p]. It returns nonzero if any neuron in the run
+/// that is not masked out was unstable.
+
+typedef int (*SyncUpdateKernel)(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, int n);
+
+int SyncUpdateScalar(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, 
+  int n); ///< Portable kernel.
+int SyncUpdateAVX2(short* state, BYTE* output, const BYTE* mask,
+  const BYTE* coin, const BYTE* degree0, const BYTE* degree1, 
+  int n); ///< AVX2 kernel.
+
+bool HasAVX2(); ///< Whether this CPU and OS support AVX2.
+SyncUpdateKernel GetSyncUpdateKernel(); ///< Fastest kernel for this CPU.
+
+#endif
@@ -31,16 +31,24 @@
 #include "Board.h"
 
 extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves.
-extern std::atomic_bool g_bFinished; ///< Search termination flag.
 
-/// Initialize the neural network.
+/// Initialize the neural network. The neurons are created in row-major
+/// order of their lower-numbered vertex, then the adjacency lists are built
+/// in compressed sparse row format with each list in order of creation.
 /// \param w Board width.
 /// \param h Board height.
 /// \param seed PRNG seed.
+/// \param bSynchronous Whether to update all neurons at once.
+/// \param pCancel Pointer to a cancellation token, if any.
 
-CTakefujiLee::CTakefujiLee(int w, int h, int seed):
-  CNeuralNet(w*h, seed), m_nWidth(w), m_nHeight(h), m_nSize(w*h)
+CTakefujiLee::CTakefujiLee(int w, int h, int seed, bool bSynchronous,
+  const CCancelToken* pCancel):
+  m_nWidth(w), m_nHeight(h), m_nSize(w*h), m_bSynchronous(bSynchronous),
+  m_pCancel(pCancel)
 { 
+  ::srand(seed); //seed the default PRNG
+  m_cRandom.srand(); //seed our PRNG
+
   for(int srcy=0; srcy<m_nHeight; srcy++)
     for(int srcx=0; srcx<m_nWidth; srcx++){
       const int src = srcy*m_nWidth + srcx;
@@ -54,120 +62,255 @@ CTakefujiLee::CTakefujiLee(int w, int h, int seed):
           if(0 <= desty && desty < m_nHeight){
             const int dest = desty*m_nWidth + destx;
 
-            if(src < dest)
-              InsertNeuron(src, dest);
+            if(src < dest){ //insert neuron between src and dest
+              m_vEndpoint.push_back(src);
+              m_vEndpoint.push_back(dest);
+            } //if
           } //if
         } //if
       } //for
     } //for
 
-  Reset();
+  m_nNumNeurons = (int)m_vEndpoint.size()/2;
+
+  m_vState.resize(m_nNumNeurons, 0);
+  m_vOldState.resize(m_nNumNeurons, 0);
+  m_vOutput.resize(m_nNumNeurons, 0);
+  m_vDegree.resize(m_nSize, 0);
+
+  //build the adjacency lists, first counting the degree of each vertex
+
+  m_vAdjStart.resize(m_nSize + 1, 0);
+
+  for(int v: m_vEndpoint)
+    m_vAdjStart[v + 1]++;
+
+  for(int v=0; v<m_nSize; v++) //prefix sum of degrees
+    m_vAdjStart[v + 1] += m_vAdjStart[v];
+
+  std::vector<int> next(m_vAdjStart.begin(), m_vAdjStart.end() - 1); //insertion points
+  m_vAdjacency.resize(m_vEndpoint.size());
+
+  for(int i=0; i<2*m_nNumNeurons; i++)
+    m_vAdjacency[next[m_vEndpoint[i]]++] = i/2;
+
+  if(m_bSynchronous)
+    InitSynchronous();
+
+  else Reset();
 } //constructor
 
-/// Reset all neuron outputs to zero and all neuron states
-/// to a random value.
+/// Reset all neuron outputs to a random value and all neuron states
+/// to zero, then choose a new update order.
 
 void CTakefujiLee::Reset(){
-  for(CEdge* pEdge: m_vEdgeList){
-    CNeuron* pNeuron = (CNeuron*)pEdge;
-    pNeuron->SetOutput(m_cRandom.randf() < 0.5f);
-    pNeuron->SetState(0);
+  std::fill(m_vDegree.begin(), m_vDegree.end(), 0);
+
+  for(int i=0; i<m_nNumNeurons; i++){
+    m_vOutput[i] = m_cRandom.randf() < 0.5f;
+    m_vOldState[i] = m_vState[i];
+    m_vState[i] = 0;
+
+    if(m_vOutput[i]){ //count output at both ends
+      m_vDegree[m_vEndpoint[2*i]]++;
+      m_vDegree[m_vEndpoint[2*i + 1]]++;
+    } //if
   } //for
 
   RandomizeEdgeList();
 } //Reset
 
-/// Update all neurons.
-/// \return true If the network has stabilized.
+/// Update a neuron. The new state of a neuron is its old state plus 4,
+/// minus the outputs of all neurons incident with either of its vertices
+/// (including itself, which is counted twice). That sum is the degree of
+/// its two vertices, which is kept up to date as outputs change.
+/// \param i Neuron index.
 
-bool CTakefujiLee::Update(){
-  for(CEdge* pEdge: m_vEdgeList){ //update neuron states
-    CNeuron* pNeuron = (CNeuron*)pEdge;
-    int newstate = pNeuron->GetState() + 4;
+void CTakefujiLee::UpdateNeuron(int i){
+  const int v0 = m_vEndpoint[2*i];
+  const int v1 = m_vEndpoint[2*i + 1];
+  const int newstate = m_vState[i] + 4 - m_vDegree[v0] - m_vDegree[v1];
 
-    UINT v0, v1;
-    pEdge->GetVertexIndices(v0, v1);
+  m_vOldState[i] = m_vState[i];
+  m_vState[i] = newstate;
 
-    for(UINT v: {v0, v1}){
-      std::vector<CEdge*>* adj = m_pVertexList[v].GetAdjacencyList();
-    
-      for(CEdge* pEdge2: *adj)
-        if(((CNeuron*)pEdge2)->GetOutput())
-          newstate -= 1;
-    } //for
+  const BYTE output = newstate > 3? 1: newstate < 0? 0: m_vOutput[i];
+
+  if(output != m_vOutput[i]){ //output flips
+    const int delta = output? 1: -1; //change in degree
+    m_vOutput[i] = output;
+    m_vDegree[v0] += delta;
+    m_vDegree[v1] += delta;
+  } //if
+} //UpdateNeuron
+
+/// Update all neurons in order, giving up part way through if the search
+/// is cancelled.
+/// \return true If the network has stabilized.
 
-    pNeuron->SetState(newstate);
+bool CTakefujiLee::Update(){
+  for(int i=0; i<m_nNumNeurons; i++){
+    if((i & (CANCEL_POLL_INTERVAL - 1)) == 0 && IsCancelled())
+      return false; //abandon the sweep
 
-    if(newstate > 3)pNeuron->SetOutput(true);
-    else if(newstate < 0)pNeuron->SetOutput(false);
+    UpdateNeuron(i);
   } //for
 
   return IsStable();
 } //Update
 
+/// Update all neurons using m_nThreads threads from the thread pool, one
+/// color class at a time. The neurons in a color class share no vertices,
+/// so they can be updated in any order, and Run() returning acts as the
+/// barrier between classes.
+/// \return true If the network has stabilized.
+
+bool CTakefujiLee::UpdateParallel(){
+  std::fill(m_vUnstable.begin(), m_vUnstable.end(), 0);
+
+  for(int c=0; c<8 && !IsCancelled(); c++) //for each color class
+    m_pPool->Run(m_nThreads, [&](int t){Sweep(t, c);});
+
+  if(IsCancelled())return false; //abandoned part way through
+
+  for(int unstable: m_vUnstable)
+    if(unstable)
+      return false;
+
+  return true;
+} //UpdateParallel
+
+/// Update thread t's share of a color class and record in m_vUnstable[t]
+/// whether any of those neurons changed state. If the search is cancelled,
+/// the rest of the share is skipped.
+/// \param t Thread index.
+/// \param c Color class.
+
+void CTakefujiLee::Sweep(int t, int c){
+  const int n = m_nClassStart[c + 1] - m_nClassStart[c]; //class size
+  const int first = m_nClassStart[c] + (int)((INT64)n*t/m_nThreads);
+  const int last = m_nClassStart[c] + (int)((INT64)n*(t + 1)/m_nThreads);
+
+  int unstable = 0; //nonzero if a neuron changed state
+
+  for(int i=first; i<last; i++){
+    if(((i - first) & (CANCEL_POLL_INTERVAL - 1)) == 0 && IsCancelled())
+      return; //abandon the rest of this share
+
+    UpdateNeuron(i);
+    unstable |= m_vState[i] != m_vOldState[i];
+  } //for
+
+  m_vUnstable[t] |= unstable;
+} //Sweep
+
+/// Get the color class of a neuron, which is twice the index of its
+/// forward knight's move plus the parity of the number of such moves from
+/// the top of the board to its lower-numbered vertex. Two neurons with the
+/// same move share a vertex only if one ends where the other starts, and
+/// then their parities differ.
+/// \param i Neuron index.
+/// \return Color class in 0..7.
+
+int CTakefujiLee::GetColor(int i){
+  const int v0 = m_vEndpoint[2*i]; //lower-numbered vertex
+  const int v1 = m_vEndpoint[2*i + 1]; //higher-numbered vertex
+  const int dx = v1%m_nWidth - v0%m_nWidth;
+  const int dy = v1/m_nWidth - v0/m_nWidth; //1 or 2
+
+  int d = 0; //forward move index
+
+  for(auto delta: g_vecDeltas)
+    if(delta.second > 0){
+      if(delta.first == dx && delta.second == dy)
+        break;
+      d++;
+    } //if
+
+  return 2*d + (v0/m_nWidth/dy)%2;
+} //GetColor
+
 /// The network is stable if all neurons are stable. 
 /// \return true If all neurons are stable.
 
 bool CTakefujiLee::IsStable(){
-  for(CEdge* pEdge: m_vEdgeList)
-    if(((CNeuron*)pEdge)->IsStable())
+  for(int i=0; i<m_nNumNeurons; i++)
+    if(m_vOldState[i] != m_vState[i])
       return false;
 
   return true;
 } //IsStable
 
+/// Determine whether the search has been cancelled, that is, whether there
+/// is a cancellation token and it has been cancelled. This is safe to call
+/// from the update threads.
+/// \return true If the search has been cancelled.
+
+bool CTakefujiLee::IsCancelled(){
+  return m_pCancel != nullptr && m_pCancel->IsCancelled();
+} //IsCancelled
+
 /// The neural network may converge to a state in which not all vertices have
 /// degree 2, which is a requirement for knight's tours and tourneys.
 /// \return true If all vertices have degree 2.
 
 bool CTakefujiLee::HasDegree2(){
-  int* degree = new int[m_nNumVerts];
-
-  for(UINT i=0; i<m_nNumVerts; i++)
-    degree[i] = 0;
-
-  for(CEdge* pEdge: m_vEdgeList){
-    CNeuron* pNeuron = (CNeuron*)pEdge;
-
-    if(pNeuron->GetOutput()){
-      UINT i, j;
-      pNeuron->GetVertexIndices(i, j);
-      degree[i]++;
-      degree[j]++;
-    } //if
-  } //for
-
-  bool bDegree2 = true;
-
-  for(UINT i=0; i<m_nNumVerts && bDegree2; i++)
-    bDegree2 = bDegree2 && degree[i] == 2;
-
-  delete [] degree;
+  for(int v=0; v<m_nSize; v++)
+    if(m_vDegree[v] != 2)
+      return false;
 
-  return bDegree2;
+  return true;
 } //HasDegree2
 
-/// Generate a tourney.
+/// Generate a tourney. If there is a thread pool and the update is
+/// asynchronous, then each update is shared among the threads in the pool.
 /// \param b [out] Chessboard.
+/// \param pPool Pointer to a thread pool to update with, if any.
 
-void CTakefujiLee::Generate(CBoard& b){
+void CTakefujiLee::Generate(CBoard& b, CThreadPool* pPool){
   bool bFinished = false;
   bool bStable = false;
+
+  m_pPool = pPool;
+  m_nThreads = (m_bSynchronous || pPool == nullptr)? 1: pPool->GetNumThreads();
+  m_vUnstable.assign(m_nThreads, 0);
   
-  while(!bFinished && !g_bFinished){
-    Reset();
+  while(!bFinished && !IsCancelled()){
+    if(m_bSynchronous)ResetSynchronous();
+    else Reset();
+
+    m_nAttempts++;
     bStable = false;
 
-    for(int j=0; j<400 && !bStable; j++)
-      bStable = Update();
+    for(int j=0; j<400 && !bStable && !IsCancelled(); j++){
+      if(m_bSynchronous)bStable = UpdateSynchronous();
+      else if(m_nThreads > 1)bStable = UpdateParallel();
+      else bStable = Update();
+
+      m_nSweeps++;
+    } //for
 
-    bFinished = HasDegree2();
+    bFinished = m_bSynchronous? HasDegree2Synchronous(): HasDegree2();
   } //while
 
-  if(bFinished)
+  if(bFinished){
+    if(m_bSynchronous)
+      SynchronousToGraph();
+
     GraphToBoard(b);
+  } //if
 } //Generate
 
+/// Get the vertex at the other end of a neuron.
+/// \param i Neuron index.
+/// \param v Vertex at one end of neuron i.
+/// \return The vertex at the other end of neuron i.
+
+int CTakefujiLee::GetOtherEnd(int i, int v){
+  const int v0 = m_vEndpoint[2*i];
+  return v0 == v? m_vEndpoint[2*i + 1]: v0;
+} //GetOtherEnd
+
 /// Assuming the neural network has converged, convert the outputs
 /// of its neurons to a move table.
 /// \param b [out] Chessboard for the results.
@@ -175,85 +318,292 @@ void CTakefujiLee::Generate(CBoard& b){
 void CTakefujiLee::GraphToBoard(CBoard& b){
   b.Clear();
 
-  for(UINT i=0; i<m_nNumVerts; i++)
-    m_pVertexList[i].Mark(false);
+  std::vector<bool> marked(m_nSize, false); //whether each vertex is marked
+  int startindex = 0;
 
-  UINT startindex = 0;
-  while(startindex < m_nNumVerts  && m_pVertexList[startindex].Marked())
-    startindex++;
+  while(startindex < m_nSize){
+    const int start = startindex;
+    int prev = start;
+    marked[prev] = true;
 
-  while(startindex < m_nNumVerts){
-    CVertex* start = &m_pVertexList[startindex];
-    CVertex* prev = start;
-    prev->Mark();
+    int edge = -1; //neuron from prev to cur
 
-    CEdge* pEdge = nullptr;
-    auto adj = prev->GetAdjacencyList();
+    for(int k=m_vAdjStart[prev]; k<m_vAdjStart[prev + 1]; k++){
+      const int i = m_vAdjacency[k];
 
-    for(auto it=(*adj).begin(); it!=(*adj).end(); it++){
-      CNeuron* pNeuron = (CNeuron*)*it;
-      if(pNeuron->GetOutput() == 1){
-        if(!pNeuron->GetNextVertex(prev)->Marked()){
-          pEdge = *it;
-          break;
-        } //if
+      if(m_vOutput[i] && !marked[GetOtherEnd(i, prev)]){
+        edge = i;
+        break;
       } //if
     } //for
 
-    CVertex* cur = pEdge->GetNextVertex(prev);
-    b.InsertUndirectedMove(prev->GetIndex(), (int)cur->GetIndex());
+    int cur = GetOtherEnd(edge, prev);
+    b.InsertUndirectedMove(prev, cur);
+
+    while(cur != start && !marked[cur]){
+      marked[cur] = true;
 
-    while(cur != start && !cur->Marked()){
-      cur->Mark();
+      int nextedge = -1; //neuron from cur to the next vertex
 
-      CEdge* pNextEdge = nullptr;
-      auto adj = cur->GetAdjacencyList();
+      for(int k=m_vAdjStart[cur]; k<m_vAdjStart[cur + 1]; k++){
+        const int i = m_vAdjacency[k];
 
-      for(auto it=(*adj).begin(); it!=(*adj).end(); it++){
-        CNeuron* pNeuron = (CNeuron*)*it;
-        if(pNeuron->GetOutput() == 1 && (*it) != pEdge){
-          pNextEdge = *it;
+        if(m_vOutput[i] && i != edge){
+          nextedge = i;
           break;
         } //if
       } //for
 
-      CVertex* next = pNextEdge->GetNextVertex(cur);
       prev = cur; 
-      cur = next;
-      b.InsertUndirectedMove(prev->GetIndex(), (int)cur->GetIndex());
+      cur = GetOtherEnd(nextedge, cur);
+      b.InsertUndirectedMove(prev, cur);
 
-      pEdge = pNextEdge;
+      edge = nextedge;
     } //while
     
-    while(startindex < m_nNumVerts && m_pVertexList[startindex].Marked())
+    while(startindex < m_nSize && marked[startindex])
       startindex++;
   } //while
 } //GraphToBoard
 
-/// Get vector of vertices adjacent to a given vertex.
-/// \param p Pointer to a vertex.
-/// \param v [out] Vector of vertices adjacent to the vertex pointed to by p.
+/// Permute the neurons into pseudorandom order for update, grouped by
+/// color class if the update is to be done by more than one thread. The
+/// neuron arrays are permuted in place so that Update() reads them in order,
+/// and the adjacency lists are renumbered to match.
+
+void CTakefujiLee::RandomizeEdgeList(){
+  const int n = m_nNumNeurons;
+  std::vector<int> perm(n); //neuron perm[i] moves to position i
+
+  for(int i=0; i<n; i++)
+    perm[i] = i;
+
+  for(int i=0; i<n; i++){
+    const int j = m_cRandom.randn((UINT)i, (UINT)n - 1);
+    std::swap(perm[i], perm[j]);
+  } //for
+
+  if(m_nThreads > 1){ //stable sort into color classes for UpdateParallel()
+    std::vector<int> color(n); //color of neuron perm[i]
+    std::fill(m_nClassStart, m_nClassStart + 9, 0);
+
+    for(int i=0; i<n; i++){
+      color[i] = GetColor(perm[i]);
+      m_nClassStart[color[i] + 1]++;
+    } //for
 
-void CTakefujiLee::GetAdjacentVertices(std::vector<CVertex*>& v, CVertex* p){
-  v.clear();
-  if(p == nullptr)return;
+    for(int c=0; c<8; c++) //prefix sum of class sizes
+      m_nClassStart[c + 1] += m_nClassStart[c];
 
-  std::vector<CEdge*>* adjacencylist = p->GetAdjacencyList();
+    int next[8]; //insertion point for each class
+    std::copy(m_nClassStart, m_nClassStart + 8, next);
 
-  for(CEdge* pEdge: *adjacencylist){
-    CVertex* pNext = pEdge->GetNextVertex(p);
-    if(pNext != nullptr)
-      v.push_back(pNext);
+    std::vector<int> sorted(n); //perm sorted by color
+    
+    for(int i=0; i<n; i++)
+      sorted[next[color[i]]++] = perm[i];
+
+    perm.swap(sorted);
+  } //if
+
+  std::vector<int> pos(n); //inverse of perm
+  std::vector<int> endpoint(2*n); //permuted endpoints
+  std::vector<int> state(n), oldstate(n); //permuted states
+  std::vector<BYTE> output(n); //permuted outputs
+
+  for(int i=0; i<n; i++){
+    const int j = perm[i];
+    pos[j] = i;
+    endpoint[2*i] = m_vEndpoint[2*j];
+    endpoint[2*i + 1] = m_vEndpoint[2*j + 1];
+    state[i] = m_vState[j];
+    oldstate[i] = m_vOldState[j];
+    output[i] = m_vOutput[j];
   } //for
-} //GetAdjacentVertices
 
-/// Permute the edge list into pseudorandom order for update.
+  m_vEndpoint.swap(endpoint);
+  m_vState.swap(state);
+  m_vOldState.swap(oldstate);
+  m_vOutput.swap(output);
 
-void CTakefujiLee::RandomizeEdgeList(){
-  const size_t n = m_vEdgeList.size();
+  for(int& i: m_vAdjacency)
+    i = pos[i];
+} //RandomizeEdgeList
 
-  for(size_t i=0; i<n; i++){
-    const int j = m_cRandom.randn((UINT)i, (UINT)n - 1);
-    std::swap(m_vEdgeList[i], m_vEdgeList[j]);
+///////////////////////////////////////////////////////////////////////////
+// Synchronous update.
+
+#pragma region Synchronous update
+
+/// Lay out the padded grids used for synchronous update. Cell (x, y) of the
+/// board is cell (x + PADDING, y + PADDING) of a grid, so that every knight's
+/// move from the board lands inside the grid. Grid d holds the neurons for
+/// the d-th knight's move that goes forward, that is, with positive vertical
+/// delta, and the mask is 1 where that move stays on the board.
+
+void CTakefujiLee::InitSynchronous(){
+  m_nPitch = m_nWidth + 2*PADDING;
+  m_nGridSize = m_nPitch*(m_nHeight + 2*PADDING);
+
+  int d = 0; //forward move index
+
+  for(auto delta: g_vecDeltas)
+    if(delta.second > 0)
+      m_nOffset[d++] = delta.second*m_nPitch + delta.first;
+
+  assert(d == 4); //safety
+
+  m_vSyncState.resize(4*m_nGridSize, 0);
+  m_vSyncOutput.resize(4*m_nGridSize, 0);
+  m_vSyncMask.resize(4*m_nGridSize, 0);
+  m_vSyncCoin.resize(4*m_nGridSize, 0);
+  m_vSyncDegree.resize(m_nGridSize, 0);
+  m_fnSyncUpdate = GetSyncUpdateKernel();
+
+  for(int y=0; y<m_nHeight; y++)
+    for(int x=0; x<m_nWidth; x++){
+      d = 0;
+
+      for(auto delta: g_vecDeltas)
+        if(delta.second > 0){
+          const int destx = x + delta.first;
+          const int desty = y + delta.second;
+
+          if(0 <= destx && destx < m_nWidth && desty < m_nHeight)
+            m_vSyncMask[d*m_nGridSize + (y + PADDING)*m_nPitch + x + PADDING] = 1;
+
+          d++;
+        } //if
+    } //for
+} //InitSynchronous
+
+/// Reset all neuron outputs to a random value and all neuron states
+/// to zero for synchronous update.
+
+void CTakefujiLee::ResetSynchronous(){
+  for(int i=0; i<4*m_nGridSize; i++){
+    m_vSyncState[i] = 0;
+    m_vSyncOutput[i] = m_vSyncMask[i] && m_cRandom.randf() < 0.5f;
+  } //for
+} //ResetSynchronous
+
+/// Count the active neurons at each cell of the padded grid. The neurons at
+/// cell p are the forward moves from p and the forward moves into p.
+
+void CTakefujiLee::ComputeSynchronousDegrees(){
+  const int n = m_nGridSize; //grid size, local so it can't be aliased
+  BYTE* degree = m_vSyncDegree.data();
+  std::fill(m_vSyncDegree.begin(), m_vSyncDegree.end(), 0);
+
+  for(int d=0; d<4; d++){
+    const BYTE* output = m_vSyncOutput.data() + d*n;
+    const int offset = m_nOffset[d];
+    
+    for(int p=0; p<n - offset; p++)
+      degree[p] += output[p];
+
+    for(int p=offset; p<n; p++)
+      degree[p] += output[p - offset];
+  } //for
+} //ComputeSynchronousDegrees
+
+/// Update all neurons at once from the outputs of the previous update,
+/// using the same rule as Update(). A purely synchronous Hopfield network
+/// tends to fall into a cycle in which neighboring neurons switch on and
+/// off together, so each neuron only applies its change of state with
+/// probability 1/2. Cells that don't hold a neuron are masked out so that
+/// the loops have no branches. The states stay within 16 bits since they
+/// change by at most 12 per update and the network is reset every 400
+/// updates. The neurons are updated in blocks of CANCEL_POLL_INTERVAL by
+/// the kernel from GetSyncUpdateKernel(), and the update gives up between
+/// blocks if the search is cancelled.
+/// \return true If the network has stabilized.
+
+bool CTakefujiLee::UpdateSynchronous(){
+  ComputeSynchronousDegrees();
+
+  for(int i=0; i<4*m_nGridSize; i+=32){ //flip a coin for each neuron
+    const UINT r = m_cRandom.randn(); //32 random bits
+    const int n = std::min(32, 4*m_nGridSize - i); //number of coins needed
+
+    for(int j=0; j<n; j++)
+      m_vSyncCoin[i + j] = m_vSyncMask[i + j] & (BYTE)(r >> j);
+  } //for
+
+  const int n = m_nGridSize; //grid size, local so it can't be aliased
+  const BYTE* degree = m_vSyncDegree.data();
+  int changed = 0; //nonzero if any neuron was not stable
+
+  for(int d=0; d<4; d++){
+    short* state = m_vSyncState.data() + d*n;
+    BYTE* output = m_vSyncOutput.data() + d*n;
+    const BYTE* mask = m_vSyncMask.data() + d*n;
+    const BYTE* coin = m_vSyncCoin.data() + d*n;
+    const int offset = m_nOffset[d];
+
+    for(int p=0; p<n - offset; p+=CANCEL_POLL_INTERVAL){
+      if(IsCancelled())
+        return false; //abandon the update
+
+      const int count = std::min(CANCEL_POLL_INTERVAL, n - offset - p);
+      changed |= m_fnSyncUpdate(state + p, output + p, mask + p, coin + p,
+        degree + p, degree + p + offset, count);
+    } //for
   } //for
-} //RandomizeEdgeList
\ No newline at end of file
+
+  return changed == 0;
+} //UpdateSynchronous
+
+/// Synchronous version of HasDegree2().
+/// \return true If all vertices have degree 2.
+
+bool CTakefujiLee::HasDegree2Synchronous(){
+  ComputeSynchronousDegrees();
+
+  for(int y=0; y<m_nHeight; y++){
+    const BYTE* degree = m_vSyncDegree.data() + (y + PADDING)*m_nPitch + PADDING;
+
+    for(int x=0; x<m_nWidth; x++)
+      if(degree[x] != 2)
+        return false;
+  } //for
+
+  return true;
+} //HasDegree2Synchronous
+
+/// Copy the neuron outputs from the padded grids to the graph so that
+/// GraphToBoard() can use them.
+
+void CTakefujiLee::SynchronousToGraph(){
+  for(int i=0; i<m_nNumNeurons; i++){
+    const int v0 = m_vEndpoint[2*i]; //lower-numbered vertex
+    const int v1 = m_vEndpoint[2*i + 1]; //higher-numbered vertex
+    const int x = v0%m_nWidth;
+    const int y = v0/m_nWidth;
+    const int offset = (v1/m_nWidth - y)*m_nPitch + v1%m_nWidth - x;
+
+    int d = 0; //forward move index
+    while(d < 3 && m_nOffset[d] != offset)d++;
+
+    m_vOutput[i] = 
+      m_vSyncOutput[d*m_nGridSize + (y + PADDING)*m_nPitch + x + PADDING];
+  } //for
+} //SynchronousToGraph
+
+#pragma endregion Synchronous update
+
+/// Reader function for the number of attempts, that is, the number of times
+/// the network was reset before it converged to a tourney.
+/// \return Number of attempts.
+
+int CTakefujiLee::GetNumAttempts(){
+  return m_nAttempts;
+} //GetNumAttempts
+
+/// Reader function for the number of sweeps, that is, the number of times
+/// that all of the neurons were updated, over all attempts.
+/// \return Number of sweeps.
+
+int CTakefujiLee::GetNumSweeps(){
+  return m_nSweeps;
+} //GetNumSweeps
@@ -26,9 +26,11 @@
 #ifndef __TakefujiLee__
 #define __TakefujiLee__
 
-#include "NeuralNet.h"
 #include "Includes.h"
+#include "Random.h"
 #include "Board.h"
+#include "ThreadPool.h"
+#include "SyncUpdate.h"
 
 /// \brief Neural network tourney generator.
 ///
@@ -42,27 +44,102 @@
 /// tourneys. It's essentially just a Hopfield network with a custom update
 /// function, so convergence is guaranteed.
 ///
+/// The network is stored as a structure of arrays. Neuron i sits on the
+/// knight's move between vertices m_vEndpoint[2*i] and m_vEndpoint[2*i + 1],
+/// and its state, old state, and output are entry i of the corresponding
+/// arrays. The neurons incident with vertex v are m_vAdjacency[k] for
+/// m_vAdjStart[v] <= k < m_vAdjStart[v + 1] (compressed sparse row format).
+/// The neurons are kept in update order, so Update() sweeps the arrays from
+/// front to back. m_vDegree[v] counts the neurons incident with vertex v
+/// whose output is on, and is adjusted whenever an output flips.
+///
+/// Update() can be spread over several threads. The neurons are then sorted
+/// into 8 color classes, one for each parity of each forward knight's move,
+/// so that no two neurons in a class share a vertex. The classes are updated
+/// one after the other, each one by all threads in parallel. That gives the
+/// same result as updating the neurons one at a time in class order, so the
+/// asynchronous semantics are kept, and the result doesn't depend on the
+/// number of threads.
+///
+/// There is also a synchronous mode, in which every neuron is updated at
+/// once from the outputs of the previous update. For that the network is
+/// laid out on padded grids, one for each of the 4 knight's moves that go
+/// forward (down the board). The neuron for the move from cell p is entry
+/// p of that move's grid, so an update is a handful of stencil loops over
+/// contiguous 8-bit and 16-bit arrays. The main loop is done by a kernel
+/// chosen when the program runs, which uses AVX2 if the CPU has it.
+/// Synchronous updates converge far less often than asynchronous ones,
+/// so it pays to compare the two modes on the board sizes of interest.
+///
 /// \image html Takefuji-Lee.png
 
-class CTakefujiLee: public CNeuralNet{
+class CTakefujiLee{
   private:
     int m_nWidth = 0; ///< Board width.
     int m_nHeight = 0; ///< Board height.
     int m_nSize = 0; ///< Board size.
+    int m_nNumNeurons = 0; ///< Number of neurons.
+
+    bool m_bSynchronous = false; ///< Whether to update all neurons at once.
+    int m_nAttempts = 0; ///< Number of times the network was reset.
+    int m_nSweeps = 0; ///< Number of updates of all neurons.
+
+    CThreadPool* m_pPool = nullptr; ///< Thread pool for Update(), if any.
+    int m_nThreads = 1; ///< Number of threads for Update().
+    int m_nClassStart[9] = {0}; ///< Start of each color class in update order.
+    std::vector<int> m_vUnstable; ///< Whether each thread changed a state.
+
+    CRandom m_cRandom; ///< Random number generator.
+    const CCancelToken* m_pCancel = nullptr; ///< Cancellation token, if any.
 
+    std::vector<int> m_vEndpoint; ///< Pairs of vertices incident with neurons.
+    std::vector<int> m_vState; ///< Neuron states.
+    std::vector<int> m_vOldState; ///< Neuron states before the last update.
+    std::vector<BYTE> m_vOutput; ///< Neuron outputs.
+    std::vector<int> m_vDegree; ///< Number of active neurons at each vertex.
+
+    std::vector<int> m_vAdjStart; ///< Start of each vertex's adjacency list.
+    std::vector<int> m_vAdjacency; ///< Neurons incident with each vertex.
+
+    int m_nPitch = 0; ///< Row length of the padded grids.
+    int m_nGridSize = 0; ///< Number of cells in each padded grid.
+    int m_nOffset[4] = {0}; ///< Cell offset of each forward knight's move.
+
+    std::vector<short> m_vSyncState; ///< Neuron states, one grid per move.
+    std::vector<BYTE> m_vSyncOutput; ///< Neuron outputs, one grid per move.
+    std::vector<BYTE> m_vSyncMask; ///< 1 where the grids hold a neuron.
+    std::vector<BYTE> m_vSyncCoin; ///< 1 where a neuron updates this time.
+    std::vector<BYTE> m_vSyncDegree; ///< Number of active neurons at each cell.
+    SyncUpdateKernel m_fnSyncUpdate = nullptr; ///< Kernel for UpdateSynchronous().
+
+    void UpdateNeuron(int i); ///< Update one neuron.
     bool Update(); ///< Update all neurons.
-    void GetAdjacentVertices(std::vector<CVertex*>& v, 
-      CVertex* p); ///< Get adjacent vertices.
+    bool UpdateParallel(); ///< Update with several threads.
+    void Sweep(int t, int c); ///< One thread's share of a color class.
+    int GetColor(int i); ///< Get color class of a neuron.
     bool IsStable(); ///< Stability test.
+    bool IsCancelled(); ///< Whether the search has been cancelled.
     bool HasDegree2(); ///< Degree test.
     void Reset(); ///< Reset.
-    void RandomizeEdgeList(); ///< Randomize the edge list.
+    void RandomizeEdgeList(); ///< Randomize the update order.
+    int GetOtherEnd(int i, int v); ///< Get other vertex of a neuron.
     void GraphToBoard(CBoard& b); ///< Convert graph to board.
 
+    void InitSynchronous(); ///< Lay out the grids for synchronous update.
+    void ResetSynchronous(); ///< Reset for synchronous update.
+    bool UpdateSynchronous(); ///< Update all neurons at once.
+    void ComputeSynchronousDegrees(); ///< Count active neurons at each cell.
+    bool HasDegree2Synchronous(); ///< Degree test for synchronous update.
+    void SynchronousToGraph(); ///< Copy synchronous outputs to the graph.
+
   public:
-    CTakefujiLee(int w, int h, int seed); ///< Constructor.
+    CTakefujiLee(int w, int h, int seed, bool bSynchronous=false,
+      const CCancelToken* pCancel=nullptr); ///< Constructor.
+
+    void Generate(CBoard& b, CThreadPool* pPool=nullptr); ///< Generate a tourney.
 
-    void Generate(CBoard& b); ///< Generate a tourney.
+    int GetNumAttempts(); ///< Get number of resets.
+    int GetNumSweeps(); ///< Get number of updates.
 }; //CTakefujiLee
 
 #endif
\ No newline at end of file
@@ -27,32 +27,39 @@
 #include "Defines.h"
 #include "Input.h"
 #include "Generator.h"
-
-std::atomic_bool g_bFinished(false); ///< Search termination flag.
  
-/// Get the board width and height, then perform the task.
+/// Get the board width and height and the time limit per search, then
+/// perform the task.
 /// \param t Tourney descriptor.
-/// \param nNumThreads Number of concurrent threads.
+/// \param pool Thread pool for the search threads.
 /// \return true If the user opts to restart instead.
 
-bool StartGenerateTask(const CTourneyDesc& t, int nNumThreads){
+bool StartGenerateTask(const CTourneyDesc& t, CThreadPool& pool){
   UINT n = 0;
   printf("Enter board width.\n");
-  const bool bRestart = ReadBoardSize(n, t);
+  bool bRestart = ReadBoardSize(n, t);
+
+  if(!bRestart){
+    UINT ms = 0; //time limit per search
+    bRestart = ReadTimeLimit(ms);
 
-  if(!bRestart)
-    CGenerator(n, n).Generate(t, nNumThreads); //perform the task
+    if(!bRestart){
+      CGenerator generator(n, n);
+      generator.SetTimeLimit(ms);
+      generator.Generate(t, pool); //perform the task
+    } //if
+  } //if
 
   return bRestart;
 } //StartGenerateTask
 
-/// Get the board width and height and the number of samples, 
-/// then perform the task.
+/// Get the board width and height, the number of samples, and the time
+/// limit per search, then perform the task.
 /// \param t Tourney descriptor.
-/// \param nNumThreads Number of concurrent threads.
+/// \param pool Thread pool for the search threads.
 /// \return true If the user opts to restart instead.
 
-bool StartMeasureTask(const CTourneyDesc& t, int nNumThreads){
+bool StartMeasureTask(const CTourneyDesc& t, CThreadPool& pool){
   UINT n = 0;
   printf("Enter board width.\n");
   bool bRestart = ReadBoardSize(n, t);
@@ -62,20 +69,78 @@ bool StartMeasureTask(const CTourneyDesc& t, int nNumThreads){
     printf("Enter number of samples.\n");
     bRestart = ReadUnsigned(nSamples, Parity::DontCare, 1);
 
+    UINT ms = 0; //time limit per search
     if(!bRestart)
-      CGenerator(n, n).Measure(t, nNumThreads, nSamples); //perform the task
+      bRestart = ReadTimeLimit(ms);
+
+    if(!bRestart){
+      CGenerator generator(n, n);
+      generator.SetTimeLimit(ms);
+      generator.Measure(t, pool, nSamples); //perform the task
+    } //if
   } //if
 
   return bRestart;
 } //StartGenerateTask
 
-/// Get the number of samples per board size and lower and upper
-/// bounds on the range of board sizes to time, then perform the task.
+/// Get the board width and height, the number of tours to stream, and
+/// whether to save each tour, then perform the task.
 /// \param t Tourney descriptor.
-/// \param nNumThreads Number of concurrent threads.
+/// \param pool Thread pool for the search threads.
 /// \return true If the user opts to restart instead.
 
-bool StartTimeTask(const CTourneyDesc& t, int nNumThreads){
+bool StartStreamTask(const CTourneyDesc& t, CThreadPool& pool){
+  UINT n = 0;
+  printf("Enter board width.\n");
+  bool bRestart = ReadBoardSize(n, t);
+
+  if(!bRestart){
+    UINT nTours = 0;
+    printf("Enter number of tours.\n");
+    bRestart = ReadUnsigned(nTours, Parity::DontCare, 1);
+
+    bool bSave = false; //whether to save each tour
+    if(!bRestart)
+      bRestart = ReadSaveTours(bSave);
+
+    if(!bRestart)
+      CGenerator(n, n).Stream(t, pool, nTours, bSave); //perform the task
+  } //if
+
+  return bRestart;
+} //StartStreamTask
+
+/// Get the board width and height and the number of search requests,
+/// then perform the task.
+/// \param t Tourney descriptor.
+/// \param pool Thread pool for the search threads.
+/// \return true If the user opts to restart instead.
+
+bool StartBenchmarkTask(const CTourneyDesc& t, CThreadPool& pool){
+  UINT n = 0;
+  printf("Enter board width.\n");
+  bool bRestart = ReadBoardSize(n, t);
+
+  if(!bRestart){
+    UINT nRequests = 0;
+    printf("Enter number of requests.\n");
+    bRestart = ReadUnsigned(nRequests, Parity::DontCare, 1);
+
+    if(!bRestart)
+      CGenerator(n, n).Benchmark(t, pool, nRequests); //perform the task
+  } //if
+
+  return bRestart;
+} //StartBenchmarkTask
+
+/// Get the number of samples per board size, lower and upper bounds on the
+/// range of board sizes to time, and the time limit per search, then
+/// perform the task.
+/// \param t Tourney descriptor.
+/// \param pool Thread pool for the search threads.
+/// \return true If the user opts to restart instead.
+
+bool StartTimeTask(const CTourneyDesc& t, CThreadPool& pool){
   UINT nSamples = 0;
   printf("Enter number of samples.\n");
   bool bRestart = ReadUnsigned(nSamples, Parity::DontCare, 1);
@@ -93,11 +158,17 @@ bool StartTimeTask(const CTourneyDesc& t, int nNumThreads){
       if(hi < lo) //in case of smart-aleck
         std::swap(lo, hi);
 
+      UINT ms = 0; //time limit per search
+      if(!bRestart)
+        bRestart = ReadTimeLimit(ms);
+
       if(!bRestart){ //perform task
         printf("This may take a while");
 
         for(UINT n=lo; n<=hi; n+=2){
-          CGenerator(n, n).Time(t, nNumThreads, nSamples); //generate
+          CGenerator generator(n, n);
+          generator.SetTimeLimit(ms);
+          generator.Time(t, pool, nSamples); //generate
           putchar('.');
         } //for
 
@@ -112,24 +183,31 @@ bool StartTimeTask(const CTourneyDesc& t, int nNumThreads){
 /// Get task-appropriate parameters from the user and run the task.
 /// \param task Task to be performed.
 /// \param t Tourney descriptor.
-/// \param nNumThreads Number of concurrent threads.
+/// \param pool Thread pool for the search threads.
 /// \return true If the user opts to restart instead.
 
-bool StartTask(Task task, const CTourneyDesc& t, int nNumThreads){
+bool StartTask(Task task, const CTourneyDesc& t, CThreadPool& pool){
   bool bRestart = false;
-  g_bFinished = false;
 
   switch(task){
     case Task::Generate:
-      bRestart = StartGenerateTask(t, nNumThreads);
+      bRestart = StartGenerateTask(t, pool);
       break;
               
     case Task::Measure:
-      bRestart = StartMeasureTask(t, nNumThreads);
+      bRestart = StartMeasureTask(t, pool);
       break;
               
     case Task::Time: 
-      bRestart = StartTimeTask(t, nNumThreads);
+      bRestart = StartTimeTask(t, pool);
+      break;
+              
+    case Task::Stream: 
+      bRestart = StartStreamTask(t, pool);
+      break;
+              
+    case Task::Benchmark: 
+      bRestart = StartBenchmarkTask(t, pool);
       break;
   } //switch
 
@@ -27,7 +27,9 @@
 #define __Task__
 
 #include "Defines.h"
+#include "ThreadPool.h"
 
-bool StartTask(Task task, const CTourneyDesc& t,int nNumThreads); ///< Start task.
+bool StartTask(Task task, const CTourneyDesc& t, 
+  CThreadPool& pool); ///< Start task.
 
 #endif
\ No newline at end of file
@@ -0,0 +1,172 @@
+/// \file ThreadPool.cpp
+/// \brief Code for the thread pool CThreadPool.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "ThreadPool.h"
+
+/// Start the worker threads and wait until they are all ready for work,
+/// recording the time that takes.
+/// \param n Number of worker threads, at least 1.
+
+CThreadPool::CThreadPool(int n): m_nThreads(std::max(1, n)){
+  const auto start = std::chrono::steady_clock::now(); //start time
+
+  for(int i=0; i<m_nThreads; i++)
+    m_vecThreadList.push_back(std::thread(&CThreadPool::Worker, this));
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cvDone.wait(lock, [&]{return m_nReady == m_nThreads;});
+
+  const std::chrono::duration<float> d = std::chrono::steady_clock::now() - start;
+  m_fStartupTime = d.count();
+} //constructor
+
+/// Tell the worker threads to terminate and wait for them to do so.
+
+CThreadPool::~CThreadPool(){
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bQuit = true;
+  }
+
+  m_cvStart.notify_all();
+
+  std::for_each(m_vecThreadList.begin(), m_vecThreadList.end(), 
+    std::mem_fn(&std::thread::join));
+} //destructor
+
+/// The code run by each worker thread. Wait for a batch that still wants
+/// runs, claim one of them and run the batch's function with its index, and
+/// repeat until told to quit.
+
+void CThreadPool::Worker(){
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  if(++m_nReady == m_nThreads)
+    m_cvDone.notify_all(); //all workers are ready
+
+  while(true){
+    m_cvStart.wait(lock, [&]{return m_bQuit || !m_stdPending.empty();});
+
+    if(m_bQuit)return;
+
+    RunOnce(*m_stdPending.front(), lock); //oldest batch with unclaimed runs
+  } //while
+} //Worker
+
+/// Claim the next unclaimed run of a batch and do it with the mutex
+/// unlocked. Assumes that the mutex is locked and that the batch has an
+/// unclaimed run. The batch leaves the pending list when its last run is
+/// claimed, which need not be at the front if it was claimed by Wait().
+/// \param batch Batch with unclaimed runs.
+/// \param lock Lock holding the mutex.
+
+void CThreadPool::RunOnce(CBatch& batch, std::unique_lock<std::mutex>& lock){
+  const int index = batch.m_nRequested - batch.m_nUnclaimed--; //run index
+  batch.m_nRunning++;
+
+  if(batch.m_nUnclaimed == 0) //all runs claimed
+    m_stdPending.erase(std::find(m_stdPending.begin(), m_stdPending.end(), 
+      &batch));
+
+  lock.unlock();
+  batch.m_fnWork(index); //do the work
+  lock.lock();
+
+  if(--batch.m_nRunning == 0 && batch.m_nUnclaimed == 0)
+    m_cvDone.notify_all(); //all work in the batch is done
+} //RunOnce
+
+/// Run a function on some of the worker threads, each running it once
+/// with a different worker index from 0 to n - 1, and wait for them all
+/// to return. This is the pool equivalent of launching n threads and
+/// joining them, except that the calling thread does any of the runs that
+/// are still unclaimed when it gets to Wait().
+/// \param n Number of workers, which is reduced to the pool size if larger.
+/// \param work Function to be run by each of the workers.
+
+void CThreadPool::Run(int n, const std::function<void(int)>& work){
+  CBatch batch; //batch of work for the workers
+  Start(batch, n, work);
+  Wait(batch);
+} //Run
+
+/// Start a function running on some of the worker threads as in Run(), but
+/// return without waiting for them. The runs are started as workers become
+/// free, after those of any batches started earlier. Every call must be
+/// followed by a call to Wait() for the same batch.
+/// \param batch [out] Batch to be filled in and run.
+/// \param n Number of workers, which is reduced to the pool size if larger.
+/// \param work Function to be run by each of the workers.
+
+void CThreadPool::Start(CBatch& batch, int n, const std::function<void(int)>& work){
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  batch.m_fnWork = work;
+  batch.m_nRequested = batch.m_nUnclaimed = std::max(0, std::min(n, m_nThreads));
+  batch.m_nRunning = 0;
+
+  if(batch.m_nUnclaimed > 0){
+    m_stdPending.push_back(&batch);
+    m_cvStart.notify_all();
+  } //if
+} //Start
+
+/// Wait for the runs in a batch started by Start() to return. Runs that no
+/// worker has claimed yet are done in this thread rather than waited for.
+/// \param batch Batch.
+
+void CThreadPool::Wait(CBatch& batch){
+  std::unique_lock<std::mutex> lock(m_mutex);
+
+  while(batch.m_nUnclaimed > 0) //help with the batch instead of idling
+    RunOnce(batch, lock);
+
+  m_cvDone.wait(lock, [&]{return batch.m_nRunning == 0;});
+} //Wait
+
+/// Determine whether any of the runs in a batch started by Start() have yet
+/// to return. Anything that they did before returning is visible to the
+/// caller once this returns false.
+/// \param batch Batch.
+/// \return true If some runs have not returned.
+
+bool CThreadPool::IsBusy(CBatch& batch){
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return batch.m_nUnclaimed > 0 || batch.m_nRunning > 0;
+} //IsBusy
+
+/// Reader function for the number of worker threads.
+/// \return Number of worker threads.
+
+int CThreadPool::GetNumThreads(){
+  return m_nThreads;
+} //GetNumThreads
+
+/// Reader function for the time taken to start the worker threads.
+/// \return Startup time in seconds.
+
+float CThreadPool::GetStartupTime(){
+  return m_fStartupTime;
+} //GetStartupTime
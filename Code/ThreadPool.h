@@ -0,0 +1,96 @@
+/// \file ThreadPool.h
+/// \brief Header for the thread pool CThreadPool.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __ThreadPool__
+#define __ThreadPool__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Thread pool.
+///
+/// A fixed set of worker threads that is created once, in main(), and kept
+/// for the life of the program so that the tasks don't pay to create and
+/// destroy threads each time they run. Run() hands a function to some of
+/// the workers, each with its own index, and waits until they have all
+/// returned from it. Start() and Wait() split Run() in two so that the
+/// caller can do work of its own while the workers run. Each call to
+/// Start() is described by a batch owned by the caller, and batches are
+/// handed to the workers in the order they were started, so several threads
+/// can share the pool, each starting and waiting for its own batches. Wait()
+/// runs any part of its batch that no worker has claimed yet in the calling
+/// thread, so a worker can run a batch of its own without deadlock even when
+/// every other worker is busy. The time taken to start the workers is
+/// recorded so that it can be reported separately from the time spent on
+/// tasks.
+
+class CThreadPool{
+  public:
+    /// \brief A batch of work.
+    ///
+    /// A function to be run a number of times, once for each index, by the
+    /// workers, and the number of those runs that have yet to start or
+    /// to finish. It must stay alive until Wait() has returned for it.
+
+    struct CBatch{
+      std::function<void(int)> m_fnWork; ///< Function that workers are to run.
+      int m_nRequested = 0; ///< Number of runs wanted.
+      int m_nUnclaimed = 0; ///< Number of runs not yet claimed by a worker.
+      int m_nRunning = 0; ///< Number of workers running m_fnWork.
+    }; //CBatch
+
+  private:
+    std::vector<std::thread> m_vecThreadList; ///< Worker threads.
+    int m_nThreads = 0; ///< Number of worker threads.
+
+    std::mutex m_mutex; ///< Mutex for thread safety.
+    std::condition_variable m_cvStart; ///< Signaled when there is work.
+    std::condition_variable m_cvDone; ///< Signaled when work is done.
+
+    std::deque<CBatch*> m_stdPending; ///< Batches with unclaimed runs.
+    int m_nReady = 0; ///< Number of workers that have started.
+    bool m_bQuit = false; ///< Tells the workers to terminate.
+
+    float m_fStartupTime = 0; ///< Time to start the workers in seconds.
+
+    void Worker(); ///< The code run by each worker.
+    void RunOnce(CBatch& batch, 
+      std::unique_lock<std::mutex>& lock); ///< Claim and do one run.
+
+  public:
+    CThreadPool(int n); ///< Constructor.
+    ~CThreadPool(); ///< Destructor.
+
+    void Run(int n, const std::function<void(int)>& work); ///< Run work.
+    void Start(CBatch& batch, int n, 
+      const std::function<void(int)>& work); ///< Start work.
+    void Wait(CBatch& batch); ///< Wait for work to finish.
+    bool IsBusy(CBatch& batch); ///< Whether work is unfinished.
+
+    int GetNumThreads(); ///< Get number of worker threads.
+    float GetStartupTime(); ///< Get time to start the workers.
+}; //CThreadPool
+
+#endif
@@ -57,7 +57,11 @@ template <class data> bool CThreadSafeQueue<data>::pop(data& element){
 /// \return the number of things in the queue.
 
 template <class data> size_t CThreadSafeQueue<data>::size(){
-  return m_stdQueue.size();
+  m_mutex.lock();
+  const size_t n = m_stdQueue.size(); //number of things in the queue
+  m_mutex.unlock();
+
+  return n;
 } //size
 
 /////////////////////////////////////////////////////////////////////////////
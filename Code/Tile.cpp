@@ -28,7 +28,7 @@
 ////////////////////////////////////////////////////////////////
 // Hard-coded CTile move tables
 
-int CTile::m_nTile6x6[36] = {
+const int CTile::m_nTile6x6[36] = {
   13, 12, 6, 11, 8, 9, 
   14, 3, 0, 22, 2, 15, 
   25, 21, 1, 23, 5, 4, 
@@ -37,7 +37,7 @@ int CTile::m_nTile6x6[36] = {
   19, 18, 24, 29, 26, 27
 }; //6x6
 
-int CTile::m_nTile8x6[48] = {
+const int CTile::m_nTile8x6[48] = {
   10, 11, 8, 9, 14, 20, 12, 13, 
   18, 24, 25, 21, 2, 3, 31, 5, 
   1, 0, 35, 4, 37, 15, 7, 6, 
@@ -46,7 +46,7 @@ int CTile::m_nTile8x6[48] = {
   34, 26, 27, 33, 38, 39, 29, 30
 }; //8x6;
 
-int CTile::m_nTile6x8[48]{
+const int CTile::m_nTile6x8[48]{
   13, 14, 6, 11, 17, 16, 
   19, 3, 0, 5, 2, 15, 
   1, 9, 22, 4, 27, 21, 
@@ -57,7 +57,7 @@ int CTile::m_nTile6x8[48]{
   31, 30, 36, 41, 38, 39 
 }; //6x8
 
-int CTile::m_nTile8x8[64] = {
+const int CTile::m_nTile8x8[64] = {
   10, 18, 8, 13, 21, 11, 23, 22, 
   25, 3, 4, 26, 6, 7, 31, 5, 
   1, 0, 24, 2, 37, 15, 39, 38, 
@@ -68,7 +68,7 @@ int CTile::m_nTile8x8[64] = {
   41, 51, 48, 49, 50, 44, 47, 53
 }; //8x8
 
-int CTile::m_nTile10x8[80] = {
+const int CTile::m_nTile10x8[80] = {
   12, 13, 10, 15, 16, 24, 14, 19, 29, 28, 
   22, 3, 4, 5, 2, 7, 8, 9, 6, 38, 
   1, 0, 41, 42, 36, 37, 47, 46, 49, 17, 
@@ -79,7 +79,7 @@ int CTile::m_nTile10x8[80] = {
   51, 63, 53, 61, 62, 67, 64, 65, 57, 58
 }; //10x8
 
-int CTile::m_nTile8x10[80]{
+const int CTile::m_nTile8x10[80]{
   17, 18, 8, 9, 10, 15, 23, 13, 
   25, 24, 0, 26, 6, 3, 4, 30, 
   1, 32, 12, 2, 5, 11, 7, 29, 
@@ -92,7 +92,7 @@ int CTile::m_nTile8x10[80]{
   66, 67, 57, 65, 70, 71, 63, 69
 }; //8x10
 
-int CTile::m_nTile10x10[100] = {
+const int CTile::m_nTile10x10[100] = {
   21, 20, 10, 15, 12, 13, 14, 19, 16, 17, 
   22, 23, 0, 1, 35, 7, 4, 29, 37, 38, 
   32, 40, 3, 2, 5, 44, 45, 6, 9, 8, 
@@ -105,7 +105,7 @@ int CTile::m_nTile10x10[100] = {
   82, 72, 84, 85, 86, 76, 88, 89, 79, 78
 }; //10x10
 
-int CTile::m_nTile10x12[120]{
+const int CTile::m_nTile10x12[120]{
   21, 20, 10, 11, 25, 13, 14, 26, 16, 17, 
   31, 30, 0, 1, 22, 36, 4, 29, 37, 7, 
   12, 2, 3, 35, 32, 6, 5, 15, 9, 8, 
@@ -120,7 +120,7 @@ int CTile::m_nTile10x12[120]{
   102, 103, 104, 92, 106, 107, 108, 109, 99, 98
 }; //10x12
 
-int CTile::m_nTile12x10[120] = {
+const int CTile::m_nTile12x10[120] = {
   14, 15, 25, 17, 29, 19, 31, 21, 22, 23, 35, 34, 
   2, 3, 24, 5, 6, 7, 41, 9, 45, 11, 47, 46, 
   1, 0, 36, 4, 18, 39, 53, 8, 42, 10, 59, 58, 
@@ -165,4 +165,55 @@ CTile::~CTile(){
   delete m_pTile10x10; 
   delete m_pTile10x12; 
   delete m_pTile12x10; 
-} //destructor
\ No newline at end of file
+} //destructor
+
+////////////////////////////////////////////////////////////////
+// Shared tile library
+
+/// Get the tile library that is shared by the whole process. It is created
+/// on first use, which is thread-safe because it is a local static.
+/// \return Reference to the shared tile library.
+
+const CTile& CTile::GetInstance(){
+  static const CTile tiles; //the one and only tile library
+  return tiles;
+} //GetInstance
+
+/// Get the identifier of the tile of a given size. The tile identifiers
+/// are the indices of the tiles in the table of tile sizes below.
+/// \param w Tile width.
+/// \param h Tile height.
+/// \return Tile identifier, or UNUSED if there is no tile of that size.
+
+int CTile::GetTileId(int w, int h){
+  static const int size[9][2] = { //tile sizes
+    {6, 6}, {8, 6}, {6, 8}, {8, 8}, {10, 8}, {8, 10}, {10, 10}, {12, 10}, 
+    {10, 12}
+  }; //size
+
+  for(int i=0; i<9; i++)
+    if(size[i][0] == w && size[i][1] == h)
+      return i;
+
+  return UNUSED;
+} //GetTileId
+
+/// Get the tile with a given identifier from the shared tile library.
+/// \param id Tile identifier from GetTileId().
+/// \return Reference to the tile.
+
+const CBoard& CTile::GetTile(int id){
+  const CTile& tiles = GetInstance(); //shorthand
+
+  switch(id){
+    case 1: return *tiles.m_pTile8x6;
+    case 2: return *tiles.m_pTile6x8;
+    case 3: return *tiles.m_pTile8x8;
+    case 4: return *tiles.m_pTile10x8;
+    case 5: return *tiles.m_pTile8x10;
+    case 6: return *tiles.m_pTile10x10;
+    case 7: return *tiles.m_pTile12x10;
+    case 8: return *tiles.m_pTile10x12;
+    default: assert(id == 0); return *tiles.m_pTile6x6;
+  } //switch
+} //GetTile
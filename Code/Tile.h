@@ -35,25 +35,27 @@
 /// for the knight's tour problem", Discrete Applied Mathematics, 73:251-260,
 /// 1997. There are hard-coded move tables for each of the tiles, but it's more
 /// convenient to have them in board form in the rest of the program.
+/// The boards are read-only and shared by the whole process. They are
+/// created the first time that a tile is asked for, so that generators
+/// don't pay for them on every construction.
 ///
 /// \image html Tiles.png
 
 class CTile{
   private:  
-    static int m_nTile6x6  [36]; ///<  6x6 move table.\image html tile6x6.png
-    static int m_nTile6x8  [48]; ///<  6x8 move table.\image html tile6x8.png
+    static const int m_nTile6x6  [36]; ///<  6x6 move table.\image html tile6x6.png
+    static const int m_nTile6x8  [48]; ///<  6x8 move table.\image html tile6x8.png
 
-    static int m_nTile8x6  [48]; ///<  8x6 move table.\image html tile8x6.png
-    static int m_nTile8x8  [64]; ///<  8x8 move table.\image html tile8x8.png
-    static int m_nTile8x10 [80]; ///<  8x10 move table.\image html tile8x10.png
+    static const int m_nTile8x6  [48]; ///<  8x6 move table.\image html tile8x6.png
+    static const int m_nTile8x8  [64]; ///<  8x8 move table.\image html tile8x8.png
+    static const int m_nTile8x10 [80]; ///<  8x10 move table.\image html tile8x10.png
 
-    static int m_nTile10x8 [80];  ///< 10x8 move table.\image html tile10x8.png
-    static int m_nTile10x10[100]; ///< 10x10 move table.\image html tile10x10.png
-    static int m_nTile10x12[120]; ///< 10x12 move table.\image html tile10x12.png
+    static const int m_nTile10x8 [80];  ///< 10x8 move table.\image html tile10x8.png
+    static const int m_nTile10x10[100]; ///< 10x10 move table.\image html tile10x10.png
+    static const int m_nTile10x12[120]; ///< 10x12 move table.\image html tile10x12.png
 
-    static int m_nTile12x10[120]; ///< 12x10 move table.\image html tile12x10.png 
+    static const int m_nTile12x10[120]; ///< 12x10 move table.\image html tile12x10.png 
 
-  protected:   
     CBoard* m_pTile6x6   = nullptr; ///< Pointer to a  6x6 chessboard. 
     CBoard* m_pTile6x8   = nullptr; ///< Pointer to a  6x8 chessboard.
 
@@ -67,9 +69,14 @@ class CTile{
 
     CBoard* m_pTile12x10 = nullptr; ///< Pointer to a 12x10 chessboard. 
 
-  public:
     CTile(); ///< Constructor.
     ~CTile(); ///< Destructor.
+
+    static const CTile& GetInstance(); ///< Get the shared tile library.
+
+  public:
+    static int GetTileId(int w, int h); ///< Get identifier of tile.
+    static const CBoard& GetTile(int id); ///< Get tile from identifier.
 }; //CTile
 
 #endif
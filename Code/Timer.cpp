@@ -36,13 +36,23 @@ void CTimer::Start(){
 
 /// Get time and date string into m_strTimeAndDate from a systime_point and
 /// return it as a null-terminated string. We're using a member variable to
-/// store an std::string so that its c_str() pointer is persistent.
+/// store an std::string so that its c_str() pointer is persistent. The
+/// reentrant version of ctime() is used so that timers in different
+/// threads don't share its static buffer.
 /// \param p An instance of systime_point.
 /// \return The corresponding time and date string.
 
 const char*  CTimer::GetDateAndTime(const systime_point p){
   const time_t t = sysclock::to_time_t(p);
-  m_strTimeAndDate = ctime(&t);
+  char buffer[32]; //at least the 26 characters that ctime needs
+
+#if defined(_MSC_VER) //Windows and Visual Studio 
+  ctime_s(buffer, sizeof(buffer), &t);
+#else //*nix
+  ctime_r(&t, buffer);
+#endif
+
+  m_strTimeAndDate = buffer;
   return m_strTimeAndDate.c_str();
 } //GetStartDateAndTime
 
@@ -0,0 +1,107 @@
+/// \file UnionFind.cpp
+/// \brief Code for CUnionFind.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "UnionFind.h"
+
+/// Create \f$n\f$ singleton sets.
+/// \param n Number of elements.
+
+CUnionFind::CUnionFind(UINT n):
+  m_vecParent(n), m_vecSize(n, 1), m_nNumSets(n)
+{
+  for(UINT i=0; i<n; i++)
+    m_vecParent[i] = i;
+} //constructor
+
+/// Find the root of the set containing an element, halving the path to
+/// the root on the way.
+/// \param i An element.
+/// \return The root of the set containing i.
+
+UINT CUnionFind::Find(UINT i){
+  while(m_vecParent[i] != i){
+    m_vecParent[i] = m_vecParent[m_vecParent[i]]; //path halving
+    i = m_vecParent[i];
+  } //while
+
+  return i;
+} //Find
+
+/// Find the root of the set containing an element without halving the path
+/// to the root. This doesn't change anything, so it is safe for several
+/// threads to call it at once. It is fastest right after Flatten().
+/// \param i An element.
+/// \return The root of the set containing i.
+
+UINT CUnionFind::GetRoot(UINT i) const{
+  while(m_vecParent[i] != i)
+    i = m_vecParent[i];
+
+  return i;
+} //GetRoot
+
+/// Make the parent of every element the root of its set, so that
+/// GetRoot() takes a single step.
+
+void CUnionFind::Flatten(){
+  for(UINT i=0; i<(UINT)m_vecParent.size(); i++)
+    m_vecParent[i] = Find(i);
+} //Flatten
+
+/// Merge the sets containing two elements, hanging the smaller set
+/// under the root of the larger one.
+/// \param i An element.
+/// \param j Another element.
+/// \return true if i and j were in different sets.
+
+bool CUnionFind::Union(UINT i, UINT j){
+  i = Find(i);
+  j = Find(j);
+  if(i == j)return false; //bail out, same set
+
+  if(m_vecSize[i] < m_vecSize[j])
+    std::swap(i, j);
+
+  m_vecParent[j] = i;
+  m_vecSize[i] += m_vecSize[j];
+  m_nNumSets--;
+
+  return true;
+} //Union
+
+/// Reader function for the number of sets.
+/// \return The number of disjoint sets.
+
+UINT CUnionFind::GetNumSets(){
+  return m_nNumSets;
+} //GetNumSets
+
+/// Get the size of the set containing an element.
+/// \param i An element.
+/// \return The number of elements in the set containing i.
+
+UINT CUnionFind::GetSetSize(UINT i){
+  return m_vecSize[Find(i)];
+} //GetSetSize
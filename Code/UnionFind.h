@@ -0,0 +1,58 @@
+/// \file UnionFind.h
+/// \brief Header for CUnionFind.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __UnionFind__
+#define __UnionFind__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Disjoint sets.
+///
+/// A union-find structure over the elements \f$0, 1, \ldots, n-1\f$, stored
+/// in flat arrays. Finds use path halving and unions are by size, so a
+/// sequence of operations takes close to linear time. It keeps a count
+/// of the number of sets, which CBoardT::Join() uses to tell when a tourney
+/// has been joined into a single cycle.
+
+class CUnionFind{
+  private:
+    std::vector<UINT> m_vecParent; ///< Parent of each element.
+    std::vector<UINT> m_vecSize; ///< Size of set, valid at roots only.
+    UINT m_nNumSets = 0; ///< Number of disjoint sets.
+
+  public:
+    CUnionFind(UINT n); ///< Constructor.
+
+    UINT Find(UINT i); ///< Find the root of the set containing an element.
+    UINT GetRoot(UINT i) const; ///< Find the root without changing anything.
+    void Flatten(); ///< Make every element point to its root.
+    bool Union(UINT i, UINT j); ///< Merge the sets containing two elements.
+
+    UINT GetNumSets(); ///< Get number of sets.
+    UINT GetSetSize(UINT i); ///< Get size of set containing an element.
+}; //CUnionFind
+
+#endif
@@ -26,38 +26,75 @@
 #include "Warnsdorff.h"
 #include "Defines.h"
 
-extern std::atomic_bool g_bFinished; ///< Search termination flag.
-extern MoveDeltas g_vecDeltas; ///< Move deltas for all possible knight's moves. 
-
 /// The default constructor seeds the PRNG.
 /// \param seed A random number seed.
+/// \param pCancel Pointer to a cancellation token, if any.
 
-CWarnsdorff::CWarnsdorff(int seed){
+CWarnsdorff::CWarnsdorff(int seed, const CCancelToken* pCancel):
+  m_pCancel(pCancel)
+{
   ::srand(seed); //seed the default PRNG
   m_cRandom.srand(); //seed our PRNG
 } //constructor
 
-/// Attempt to generate a random knight's tour.
+/// Determine whether the search has been cancelled. This is called once
+/// per move, so the cancellation token is only checked on every
+/// CANCEL_POLL_INTERVAL-th call, and once cancelled the search stays
+/// cancelled.
+/// \return true If the search has been cancelled.
+
+bool CWarnsdorff::IsCancelled(){
+  if(m_pCancel != nullptr && !m_bCancelled && 
+    (++m_nPolls & (CANCEL_POLL_INTERVAL - 1)) == 0)
+    m_bCancelled = m_pCancel->IsCancelled();
+
+  return m_bCancelled;
+} //IsCancelled
+
+/// Build a table that maps the difference between two cell indices on a
+/// padded board, plus the largest backwards difference for a knight's move,
+/// to a mask with bit k set if the difference is that of move k, so that
+/// finding whether one cell is a knight's move away from another takes a
+/// single lookup. Every knight's move from a cell on a padded board stays
+/// in the move table, so there is no need to check the move mask.
+/// \param b Padded board.
+
+void CWarnsdorff::BuildMoveBits(CBoard& b){
+  m_nMoveBias = 0;
+
+  for(int k=0; k<8; k++)
+    m_nMoveBias = std::max(m_nMoveBias, std::abs(b.GetMoveOffset(k)));
+
+  m_vMoveBit.assign(2*m_nMoveBias + 1, 0);
+
+  for(int k=0; k<8; k++)
+    m_vMoveBit[b.GetMoveOffset(k) + m_nMoveBias] = 1 << k;
+} //BuildMoveBits
+
+/// Attempt to generate a random knight's tour. Assumes that the board is
+/// padded and that BuildMoveBits() has been called for it. The exits from
+/// the target cell that are still unused are kept in a bit mask over the
+/// target's move indices, and a step of the walk clears the bit for the
+/// cell that it lands on with one table lookup.
 /// \param b [out] Board for generated tour.
 /// \return true if generation is successful.
 
 bool CWarnsdorff::GenerateTour(CBoard& b){
-  const int w = b.GetWidth();
   const int n = b.GetSize();
   
   b.Clear(); 
 
-  int target = m_cRandom.randn(0, n - 1);
+  int target = b.GetPaddedIndex(m_cRandom.randn(0, n - 1));
   int current = target;
 
   int next; 
   int nVisited = 1;
   
-  std::set<int> m_bEgress;
+  BYTE egress = 0; //bit k is set if move k from target is an unused exit
   
-  for(MoveDelta delta: g_vecDeltas)
-   if(b.IsOnBoard(target, delta))
-     m_bEgress.insert(target + delta.second*w + delta.first);
+  for(int k=0; k<8; k++)
+    if(b[target + b.GetMoveOffset(k)] != BLOCKED)
+      egress |= 1 << k;
 
   int available[8];
   int preferred[8];
@@ -72,9 +109,9 @@ bool CWarnsdorff::GenerateTour(CBoard& b){
     //enumerate all possible places you could jump to from current and
     //record them in array "available", setting "count" to the number of them
     
-    for(MoveDelta delta: g_vecDeltas){  
-      int next = current + delta.second*w + delta.first; 
-      if(b.IsOnBoard(current, delta) && b[next] == UNUSED)
+    for(int k=0; k<8; k++){  
+      int next = current + b.GetMoveOffset(k); 
+      if(b[next] == UNUSED) //sentinels are BLOCKED
         available[count++] = next;
     } //for
 
@@ -119,10 +156,13 @@ bool CWarnsdorff::GenerateTour(CBoard& b){
       nVisited++; //one more square visited
     } //if
 
-    m_bEgress.erase(current); //we've used up 1 exit point
-  }while(count > 0 && m_bEgress.size() > 0 && !g_bFinished);
+    const int d = current - target + m_nMoveBias; //biased cell difference
 
-  if(!g_bFinished && b.IsKnightMove(current, target) && nVisited >= n){
+    if(0 <= d && d < (int)m_vMoveBit.size()) //close enough to be an exit
+      egress &= ~m_vMoveBit[d]; //if it is, we've used up 1 exit point
+  }while(count > 0 && egress != 0 && !IsCancelled());
+
+  if(!IsCancelled() && b.IsKnightMove(current, target) && nVisited >= n){
     b.InsertUndirectedMove(current, target); 
     return true;
   } //if
@@ -130,24 +170,24 @@ bool CWarnsdorff::GenerateTour(CBoard& b){
   return false;
 } //GenerateTour
 
-/// Attempt to generate a random tourney.
+/// Attempt to generate a random tourney. Assumes that the board is padded.
 /// \param b [in, out] Chessboard.
 /// \return true if generation is successful.
 
 bool CWarnsdorff::GenerateTourney(CBoard& b){
   const int w = b.GetWidth();
-  const int n = b.GetSize();
+  const int n = b.GetTableSize();
 
   bool bCycleCover = false; 
 
   b.Clear(); 
 
-  for(int i=0; i<4*w && !bCycleCover; i++){
+  for(int i=0; i<4*w && !bCycleCover && !IsCancelled(); i++){
     bool bFinished = false;
     int first = 0;
 
     //find an unused cell
-    while(b[first] != UNUSED && first < n)
+    while(first < n && b[first] != UNUSED)
       first++;
 
     bCycleCover = first >= n;
@@ -180,13 +220,14 @@ bool CWarnsdorff::GenerateTourney(CBoard& b){
 } //GenerateTourney
 
 /// Take a random walk and close it into a cycle at the first opportunity.
+/// Assumes that the board is padded. The walk stops early if the search
+/// is cancelled.
 /// \param b [in, out] Chessboard.
 /// \param start Index of the first cell on the walk.
 /// \return Index of the last cell on the walk.
 
 int CWarnsdorff::RandomClosedWalk(CBoard& b, int start){
   const int w = b.GetWidth();
-  const int n = b.GetSize();
   
   int next = 0; 
   int current = start;
@@ -199,16 +240,18 @@ int CWarnsdorff::RandomClosedWalk(CBoard& b, int start){
 
   int available[8];
 
-  while(nNumTrials < 4*w && (!b.IsKnightMove(current, start) || nVisited < 6)){
+  while(nNumTrials < 4*w && (!b.IsKnightMove(current, start) || nVisited < 6)
+    && !IsCancelled())
+  {
     nNumTrials++;
     nNextMoveCount = 0;
 
     //enumerate all possible places you could jump to from current and
     //record them in array "available", setting "count" to the number of them
     
-    for(MoveDelta delta: g_vecDeltas) {  
-      int next = current + delta.second*w + delta.first; 
-      if(b.IsOnBoard(current, delta) && b[next] == UNUSED)
+    for(int k=0; k<8; k++){  
+      int next = current + b.GetMoveOffset(k); 
+      if(b[next] == UNUSED) //sentinels are BLOCKED
         available[nNextMoveCount++] = next;
     } //for
 
@@ -259,22 +302,30 @@ int CWarnsdorff::RandomClosedWalk(CBoard& b, int start){
 } //RandomClosedWalk
 
 /// Generate a knight's tour or tourney using Warnsdorff's algorithm.
+/// The board is padded while the moves are being generated so that
+/// the inner loops need not check that moves stay on the board.
 /// \param b [out] Board.
 /// \param t Cycle type. 
 
 void CWarnsdorff::Generate(CBoard& b, CycleType t){
+  b.MakePadded();
+
   switch(t){
     case CycleType::Tour:
-      while(!GenerateTour(b) && !g_bFinished); //generate tour
+      BuildMoveBits(b);
+      while(!GenerateTour(b) && !IsCancelled()); //generate tour
       break;
       
     case CycleType::Tourney:
-      while(!GenerateTourney(b) && !g_bFinished); //generate tourney
+      while(!GenerateTourney(b) && !IsCancelled()); //generate tourney
       break;
 
     case CycleType::TourFromTourney:
-      while(!GenerateTourney(b) && !g_bFinished); //generate tourney
-      b.JoinUntilTour(); //make tour from tourney
+      while(!GenerateTourney(b) && !IsCancelled()); //generate tourney
+      b.MakeUnpadded();
+      b.JoinUntilTour(nullptr, m_pCancel); //make tour from tourney
       break;
   } //switch
+
+  b.MakeUnpadded();
 } //Generate
@@ -57,6 +57,15 @@
 class CWarnsdorff{
   private:    
     CRandom m_cRandom; ///< PRNG.
+    const CCancelToken* m_pCancel = nullptr; ///< Cancellation token, if any.
+    UINT m_nPolls = 0; ///< Number of calls to IsCancelled().
+    bool m_bCancelled = false; ///< Whether cancellation has been seen.
+
+    std::vector<BYTE> m_vMoveBit; ///< Move index bit for each cell difference.
+    int m_nMoveBias = 0; ///< Largest backwards difference for a move.
+
+    bool IsCancelled(); ///< Whether the search has been cancelled.
+    void BuildMoveBits(CBoard& b); ///< Build the move index bit table.
 
     int RandomClosedWalk(CBoard& b, int start); ///< Create closed random walk.
 
@@ -64,7 +73,8 @@ class CWarnsdorff{
     bool GenerateTourney(CBoard& b); ///< Generate a tourney.
 
   public:
-    CWarnsdorff(int seed); ///< Constructor.
+    CWarnsdorff(int seed, 
+      const CCancelToken* pCancel=nullptr); ///< Constructor.
 
     void Generate(CBoard& b, CycleType t); ///< Generate a tour or tourney.
 }; //CWarnsdorff
@@ -0,0 +1,142 @@
+/// \file WorkStealingQueue.cpp
+/// \brief Code for the work-stealing queue CWorkStealingQueue.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "WorkStealingQueue.h"
+#include "Structs.h"
+
+/// Create the deques.
+/// \param n Number of deques, which defaults to the number of hardware threads.
+
+template <class data> CWorkStealingQueue<data>::CWorkStealingQueue(int n):
+  m_nNext(0)
+{
+  if(n <= 0)
+    n = (int)std::thread::hardware_concurrency();
+
+  m_nNumDeques = std::max(1, n);
+  m_pDeque = new CDeque[m_nNumDeques];
+} //constructor
+
+/// Delete the deques.
+
+template <class data> CWorkStealingQueue<data>::~CWorkStealingQueue(){
+  delete [] m_pDeque;
+} //destructor
+
+/// Insert an element at the back of the next deque in turn.
+/// \param element An element.
+
+template <class data> void CWorkStealingQueue<data>::push(const data& element){
+  CDeque& d = m_pDeque[m_nNext++%m_nNumDeques]; //deque to insert into
+
+  d.m_mutex.lock();
+  d.m_stdDeque.push_back(element);
+  d.m_mutex.unlock();
+} //push
+
+/// Delete and return an element for a worker, taking it from the back of
+/// the worker's own deque if possible, otherwise stealing it from the front
+/// of the first non-empty deque after it.
+/// \param element [out] The element deleted.
+/// \param worker Worker index.
+/// \return true If there was an element to delete.
+
+template <class data> bool CWorkStealingQueue<data>::pop(data& element, int worker){
+  const int own = worker%m_nNumDeques; //worker's own deque
+
+  for(int i=0; i<m_nNumDeques; i++){
+    CDeque& d = m_pDeque[(own + i)%m_nNumDeques]; //own deque first
+    bool success = false; //true if there was something to delete
+
+    d.m_mutex.lock();
+
+    if(!d.m_stdDeque.empty()){ //deque has something in it
+      if(i == 0){ //own deque
+        element = d.m_stdDeque.back();
+        d.m_stdDeque.pop_back();
+      } //if
+
+      else{ //steal
+        element = d.m_stdDeque.front();
+        d.m_stdDeque.pop_front();
+      } //else
+
+      success = true;
+    } //if
+
+    d.m_mutex.unlock();
+
+    if(success)
+      return true;
+  } //for
+
+  return false;
+} //pop
+
+/// Get the number of things in the deques.
+/// \return the number of things in the deques.
+
+template <class data> size_t CWorkStealingQueue<data>::size(){
+  size_t n = 0; //return value
+
+  for(int i=0; i<m_nNumDeques; i++){
+    CDeque& d = m_pDeque[i]; //current deque
+
+    d.m_mutex.lock();
+    n += d.m_stdDeque.size();
+    d.m_mutex.unlock();
+  } //for
+
+  return n;
+} //size
+
+/// Change the number of deques, dealing the elements out among the new ones
+/// in turn. This is not thread-safe, so it must only be called while no
+/// other thread is using the queue.
+/// \param n Number of deques.
+
+template <class data> void CWorkStealingQueue<data>::resize(int n){
+  n = std::max(1, n);
+  if(n == m_nNumDeques)return; //nothing to do
+
+  CDeque* pDeque = new CDeque[n]; //new deques
+  UINT next = 0; //index of next deque to insert into
+
+  for(int i=0; i<m_nNumDeques; i++){
+    for(const data& element: m_pDeque[i].m_stdDeque)
+      pDeque[next++%n].m_stdDeque.push_back(element);
+  } //for
+
+  delete [] m_pDeque;
+  m_pDeque = pDeque;
+  m_nNumDeques = n;
+  m_nNext = next;
+} //resize
+
+/////////////////////////////////////////////////////////////////////////////
+
+//explicit template instantiations
+
+template class CWorkStealingQueue<CSearchRequest>; ///< Work-stealing queue of requests.
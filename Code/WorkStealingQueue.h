@@ -0,0 +1,66 @@
+/// \file WorkStealingQueue.h
+/// \brief Header for the work-stealing queue CWorkStealingQueue.
+
+// MIT License
+//
+// Copyright (c) 2019 Ian Parberry
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifndef __WorkStealingQueue__
+#define __WorkStealingQueue__
+
+#include "Includes.h"
+#include "Defines.h"
+
+/// \brief Work-stealing queue.
+///
+/// A thread-safe pool of work for a set of worker threads. Instead of one
+/// queue behind one mutex that every worker contends for, each worker has
+/// a deque of its own with its own mutex. Insertions are dealt out among
+/// the deques in turn. A worker takes from the back of its own deque, and
+/// only when that is empty does it steal from the front of the others, so
+/// workers seldom touch the same mutex. Worker indices larger than the
+/// number of deques wrap around.
+
+template<class data> class CWorkStealingQueue{ 
+  private:
+    /// \brief One worker's deque.
+
+    struct CDeque{
+      std::deque<data> m_stdDeque; ///< Deque contents.
+      std::mutex m_mutex; ///< Mutex for thread safety.
+      char m_cPadding[64]; ///< Keeps neighboring mutexes off one cache line.
+    }; //CDeque
+
+    CDeque* m_pDeque = nullptr; ///< Array of deques, one per worker.
+    int m_nNumDeques = 0; ///< Number of deques.
+    std::atomic<UINT> m_nNext; ///< Counter for dealing out insertions.
+
+  public:
+    CWorkStealingQueue(int n=0); ///< Constructor.
+    ~CWorkStealingQueue(); ///< Destructor.
+
+    void push(const data& element); ///< Insert.
+    bool pop(data& element, int worker=0); ///< Delete and return.
+    size_t size(); ///< Get queue size.
+    void resize(int n); ///< Change the number of deques.
+}; //CWorkStealingQueue
+
+#endif